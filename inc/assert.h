@@ -5,23 +5,37 @@
  *
  * Features:
  *  - Configurable UART for logging assertion failures (default: USART1)
- *  - Sends human-readable message with line number and file name
- *  - Halts execution in an infinite loop after logging
+ *  - Four levels picked with `ASSERT_LEVEL`:
+ *      ASSERT_LEVEL_OFF   - compiled out, the condition isn't evaluated
+ *      ASSERT_LEVEL_BKPT  - `bkpt`, halts in the debugger (HardFault without one)
+ *      ASSERT_LEVEL_TOKEN - a 32 bit token (file hash << 16 | line) is logged, no strings in flash
+ *      ASSERT_LEVEL_FULL  - line number and file name (default)
+ *  - `STATIC_ASSERT(cond, msg)` for compile time checks (from badhal.h)
  *  - Simple macro `ASSERT(x)` for runtime checks
  *
  * Usage:
  *  #define ASSERT_UART USART2   // Optional, override default USART1
+ *  #define ASSERT_LEVEL ASSERT_LEVEL_TOKEN // Optional
  *  #define BAD_ASSERT_IMPLEMENTATION
  *  #include "assert.h"
  *
  *  int x = 5;
  *  ASSERT(x == 10);  // Logs failure via UART and halts
  *
+ *  // token level prints "ASSERT 4C1A0077", decode it on the host with
+ *  // python3 tools/assert_decode.py 4C1A0077
+ *
  * Notes:
- *  - The UART is reconfigured with default settings (9600 baud, TX enabled) 
- *    when an assertion fails.
- *  - This is a blocking assertion mechanism; system execution stops on failure.
- *  - Intended for debugging; not recommended for production code in performance-critical paths.
+ *  - FULL reconfigures the UART with default settings (9600 baud, TX enabled)
+ *    when an assertion fails. TOKEN uses the UART as the application left it
+ *    and keeps the last token in `assert_token` (.noinit), so it also survives
+ *    an `ASSERT_HALT` that resets.
+ *  - The file hash is taken over the file name only (`__FILE_NAME__`, first
+ *    ASSERT_HASH_LEN chars), tools/assert_decode.py has to use the same hash.
+ *    Compilers without `__FILE_NAME__` (gcc < 12) hash `__FILE__`, the path as
+ *    passed to the compiler. The decoder also indexes paths relative to the repo
+ *    root, so build from the root (the Makefile does) for those to decode.
+ *  - Every level except OFF is blocking, override `ASSERT_HALT` to reset instead.
  */
 
 
@@ -38,17 +52,77 @@
 
 #define FAULT_LOG_UART_SETTINGS (USART_FEATURE_TRANSMIT_EN)
 
+#define ASSERT_LEVEL_OFF    (0)
+#define ASSERT_LEVEL_BKPT   (1)
+#define ASSERT_LEVEL_TOKEN  (2)
+#define ASSERT_LEVEL_FULL   (3)
+
+#ifndef ASSERT_LEVEL
+#define ASSERT_LEVEL ASSERT_LEVEL_FULL
+#endif
+
+#ifndef ASSERT_HALT
+#define ASSERT_HALT() while (1)
+#endif
+
+#ifdef __FILE_NAME__
+#define ASSERT_FILE __FILE_NAME__
+#else
+#define ASSERT_FILE __FILE__
+#endif
+
+// h = h * 31 + c over the first ASSERT_HASH_LEN chars, zero padded. Written so h
+// appears once per step, the expansion stays linear.
+#define ASSERT_HASH_LEN (32)
+#define ASSERT_HASH_C(s,i) ((i) < sizeof(s) - 1 ? (uint8_t)(s)[i] : 0U)
+#define ASSERT_HASH_STEP(h,s,i) (((h) * 31U) + ASSERT_HASH_C(s,i))
+#define ASSERT_HASH4(h,s,i) \
+    ASSERT_HASH_STEP(ASSERT_HASH_STEP(ASSERT_HASH_STEP(ASSERT_HASH_STEP(h,s,i),s,(i)+1),s,(i)+2),s,(i)+3)
+#define ASSERT_HASH16(h,s,i) \
+    ASSERT_HASH4(ASSERT_HASH4(ASSERT_HASH4(ASSERT_HASH4(h,s,i),s,(i)+4),s,(i)+8),s,(i)+12)
+#define ASSERT_HASH(s) ASSERT_HASH16(ASSERT_HASH16(0U,s,0),s,16)
+#define ASSERT_HASH16BIT(h) (((h) ^ ((h) >> 16)) & 0xFFFFU)
+
+#define ASSERT_TOKEN(file,line) ((uint32_t)(ASSERT_HASH16BIT((uint32_t)ASSERT_HASH(file)) << 16) | ((line) & 0xFFFFU))
+
+#if ASSERT_LEVEL == ASSERT_LEVEL_OFF
+#define ASSERT(x) ((void)sizeof(x))
+
+#elif ASSERT_LEVEL == ASSERT_LEVEL_BKPT
+#define ASSERT(x)                                  \
+    do {                                          \
+        if (!(x)) {                               \
+            __asm volatile("bkpt #0");            \
+        }                                         \
+    } while (0)
+
+#elif ASSERT_LEVEL == ASSERT_LEVEL_TOKEN
+// static const forces the hash to be folded at -O0 too
+#define ASSERT(x)                                  \
+    do {                                          \
+        if (!(x)) {                               \
+            static const uint32_t __assert_token = ASSERT_TOKEN(ASSERT_FILE, __LINE__); \
+            assert_failed_token(__assert_token);  \
+        }                                         \
+    } while (0)
+
+#else
 #define ASSERT(x)                                  \
     do {                                          \
         if (!(x)) {                               \
             assert_failed(__LINE__, __FILE__);    \
         }                                         \
     } while (0)
+#endif
 
 extern void assert_failed(uint32_t line, char *file);
+extern void assert_failed_token(uint32_t token);
+extern uint32_t assert_token;
 
 #ifdef BAD_ASSERT_IMPLEMENTATION
 
+uint32_t assert_token ATTR_NOINIT;
+
 extern void assert_failed(uint32_t line, char *file) {
     uart_disable(ASSERT_UART);
     uart_setup(ASSERT_UART, USART_BRR_9600, FAULT_LOG_UART_SETTINGS, 0, 0);
@@ -58,9 +132,16 @@ extern void assert_failed(uint32_t line, char *file) {
     uart_send_str_polling(ASSERT_UART, "FILE:");
     uart_send_str_polling(ASSERT_UART, file);
     uart_send_str_polling(ASSERT_UART, "\r\n");
-    while (1);
+    ASSERT_HALT();
 }
 
-#endif 
+extern void assert_failed_token(uint32_t token) {
+    assert_token = token;
+    uart_send_str_polling(ASSERT_UART, "ASSERT ");
+    uart_send_hex_32bit(ASSERT_UART, token);
+    ASSERT_HALT();
+}
 
-#endif 
+#endif
+
+#endif
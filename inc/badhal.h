@@ -13,6 +13,7 @@
 #define BAD_HAL_USE_NVIC
 #define BAD_HAL_USE_SYSTICK
 #define BAD_HAL_USE_FPU
+#define BAD_HAL_USE_DWT
 //Peripherals
 #define BAD_HAL_USE_USART
 #define BAD_HAL_USE_GPIO
@@ -22,6 +23,8 @@
 #define BAD_HAL_USE_SYSCFG
 #define BAD_HAL_USE_BTIMER
 #define BAD_HAL_USE_CRC
+#define BAD_HAL_USE_ADC
+#define BAD_HAL_USE_PWR
 //common defines
 
 #define __IO volatile
@@ -29,15 +32,42 @@
 #define CLOCK_SPEED 100000000UL         //100MHZ
 #define FALLBACK_CLOCK_SPEED 16000000UL //16MHZ
 //hw interrupts (triggered by hardware and handled in drivers)
-#define STRONG_ISR(x) void x(void)
+#define STRONG_ISR(x) BAD_ISR_HOT void x(void)
 #define WEAK_ISR(x) void x(void) __attribute__((weak, alias("default_isr")))
 #define STRONG_USER_ISR(x,...) void x(__VA_ARGS__)
 #define WEAK_USER_ISR(x,...) void x(__VA_ARGS__) __attribute__((weak, alias(#x"_default")))
 #define DEFAULT_USER_ISR(x,...) void x##_default(__VA_ARGS__)
 #define WEAK_PERIPH_USER_ISR(x,default_isr,...) void x(__VA_ARGS__) __attribute__((weak, alias(#default_isr"_default")))
 #define ATTR_RAMFUNC __attribute__((section(".ramfunc")))
+#define ATTR_NOINIT __attribute__((section(".noinit")))
 #define ALWAYS_STATIC static inline
+#define ALWAYS_INLINE static inline __attribute__((always_inline))
 #define UNUSED(x) (void)x
+#define STATIC_ASSERT(cond,msg) _Static_assert(cond, msg)
+
+//hot paths run from SRAM (no flash wait states, latency independent of the ART cache)
+//-DBAD_RAMFUNC_ALL or per module -DBAD_ISR_RAMFUNC, BAD_SPI_RAMFUNC, BAD_USART_RAMFUNC,
+//BAD_ADC_RAMFUNC, BAD_ILI9341_RAMFUNC, BAD_APP_RAMFUNC (APP_HOT, for user kernels)
+#ifdef BAD_RAMFUNC_ALL
+#define BAD_ISR_RAMFUNC
+#define BAD_SPI_RAMFUNC
+#define BAD_USART_RAMFUNC
+#define BAD_ADC_RAMFUNC
+#define BAD_ILI9341_RAMFUNC
+#define BAD_APP_RAMFUNC
+#endif
+
+#ifdef BAD_ISR_RAMFUNC
+#define BAD_ISR_HOT ATTR_RAMFUNC
+#else
+#define BAD_ISR_HOT
+#endif
+
+#ifdef BAD_APP_RAMFUNC
+#define APP_HOT ATTR_RAMFUNC
+#else
+#define APP_HOT
+#endif
 
 #define OPT_BARRIER asm volatile("": : :"memory")
 #define DSB __asm volatile("dsb":::"memory")
@@ -45,6 +75,9 @@
 #define ISB __asm volatile("isb":::"memory")
 #define __ENABLE_INTERUPTS __asm volatile ("cpsie i":::"memory")
 #define __DISABLE_INTERUPTS __asm volatile ("cpsid i":::"memory")
+#define WFI __asm volatile("wfi":::"memory")
+#define WFE __asm volatile("wfe":::"memory")
+#define SEV __asm volatile("sev":::"memory")
 
 //Core
 
@@ -120,6 +153,47 @@ typedef enum{
     SCB_FPU_FULL_ACCESS = 15,
 }SCB_FPU_permission_t;
 
+//without these MemManage, BusFault and UsageFault escalate to HardFault
+typedef enum{
+    SCB_FAULT_MEMMANAGE = (1UL << 16),
+    SCB_FAULT_BUSFAULT  = (1UL << 17),
+    SCB_FAULT_USAGE     = (1UL << 18),
+    SCB_FAULT_ALL       = (0x7UL << 16)
+}SCB_fault_handler_t;
+
+//extra UsageFault traps in CCR
+typedef enum{
+    SCB_TRAP_UNALIGNED  = 0x8,
+    SCB_TRAP_DIV_0      = 0x10
+}SCB_trap_t;
+
+//CFSR, MemManage in the low byte, BusFault in the next, UsageFault in the top half
+typedef enum{
+    SCB_CFSR_IACCVIOL    = (1UL << 0),
+    SCB_CFSR_DACCVIOL    = (1UL << 1),
+    SCB_CFSR_MUNSTKERR   = (1UL << 3),
+    SCB_CFSR_MSTKERR     = (1UL << 4),
+    SCB_CFSR_MLSPERR     = (1UL << 5),
+    SCB_CFSR_MMARVALID   = (1UL << 7),
+    SCB_CFSR_IBUSERR     = (1UL << 8),
+    SCB_CFSR_PRECISERR   = (1UL << 9),
+    SCB_CFSR_IMPRECISERR = (1UL << 10),
+    SCB_CFSR_UNSTKERR    = (1UL << 11),
+    SCB_CFSR_STKERR      = (1UL << 12),
+    SCB_CFSR_LSPERR      = (1UL << 13),
+    SCB_CFSR_BFARVALID   = (1UL << 15),
+    SCB_CFSR_UNDEFINSTR  = (1UL << 16),
+    SCB_CFSR_INVSTATE    = (1UL << 17),
+    SCB_CFSR_INVPC       = (1UL << 18),
+    SCB_CFSR_NOCP        = (1UL << 19),
+    SCB_CFSR_UNALIGNED   = (1UL << 24),
+    SCB_CFSR_DIVBYZERO   = (1UL << 25)
+}SCB_cfsr_t;
+
+#define SCB_CFSR_MMFSR_MASK     (0xFFUL)
+#define SCB_CFSR_BFSR_MASK      (0xFF00UL)
+#define SCB_CFSR_UFSR_MASK      (0xFFFF0000UL)
+
 #define SCB ((SCB_typedef_t *) 0xE000ED00UL)
 
 #define SCB_AIRCR_VECTKEY_SHIFT             16U                                            
@@ -127,6 +201,7 @@ typedef enum{
 #define SCB_ICSR_PENDSVSET                  (0x1 << 28 ) 
 #define SCB_AIRCR_PRIGROUP_SHIFT            8                                            
 #define SCB_AIRCR_PRIGROUP_MASK             (7 << SCB_AIRCR_PRIGROUP_SHIFT)                
+#define SCB_AIRCR_SYSRESETREQ               (0x1 << 2)
 #define SCB_CPACR_FPU_SHIFT                 20U
 #define SCB_CPACR_FPU_MASK                  (0xF << SCB_CPACR_FPU_SHIFT)
 
@@ -134,6 +209,38 @@ ALWAYS_STATIC void SCB_trigger_pendsv(){
     SCB->ICSR = SCB_ICSR_PENDSVSET;
 }
 
+ALWAYS_STATIC void __attribute__((noreturn)) SCB_system_reset(){
+    DSB;
+    SCB->AIRCR = (0x5FA << SCB_AIRCR_VECTKEY_SHIFT) | (SCB->AIRCR & SCB_AIRCR_PRIGROUP_MASK) | SCB_AIRCR_SYSRESETREQ;
+    DSB;
+    while(1);
+}
+
+//needs BAD_FAULT_SPLIT_ISR_IMPLEMENTATION or own isr_memmanage/busfault/usagefault
+ALWAYS_STATIC void SCB_enable_fault_handlers(SCB_fault_handler_t faults){
+    SCB->SHCSR |= faults;
+    DSB;
+    ISB;
+}
+
+ALWAYS_STATIC void SCB_disable_fault_handlers(SCB_fault_handler_t faults){
+    SCB->SHCSR &= ~faults;
+    DSB;
+    ISB;
+}
+
+ALWAYS_STATIC void SCB_enable_traps(SCB_trap_t traps){
+    SCB->CCR |= traps;
+    DSB;
+    ISB;
+}
+
+ALWAYS_STATIC void SCB_disable_traps(SCB_trap_t traps){
+    SCB->CCR &= ~traps;
+    DSB;
+    ISB;
+}
+
 ALWAYS_STATIC void SCB_set_priority_grouping(SCB_prio_grouping_t prio){
     uint32_t reg_value  =  SCB->AIRCR;                                                
     reg_value &= ~(SCB_AIRCR_VECTKEY_MASK | SCB_AIRCR_PRIGROUP_MASK);  
@@ -205,7 +312,7 @@ typedef enum{
     (x) <=1024 ? 1024: \
     (x) <=2048 ? 2048: \
     (x) <=4096 ? 4096: \
-    (x) <=8192 ? 8912: \
+    (x) <=8192 ? 8192: \
     16384\
 )
 
@@ -229,17 +336,59 @@ typedef enum{
     (x) == 2048 ? (10<<1):\
     (x) == 4096 ? (11<<1):\
     (x) == 8192 ? (12<<1):\
-    16384\
+    (13<<1)\
 )
+
+//RASR SIZE field, region is 2^(n+1) bytes and its base has to be aligned to it
+typedef enum{
+    MPU_SIZE_32B    = (4 << 1),
+    MPU_SIZE_64B    = (5 << 1),
+    MPU_SIZE_128B   = (6 << 1),
+    MPU_SIZE_256B   = (7 << 1),
+    MPU_SIZE_512B   = (8 << 1),
+    MPU_SIZE_1KB    = (9 << 1),
+    MPU_SIZE_2KB    = (10 << 1),
+    MPU_SIZE_4KB    = (11 << 1),
+    MPU_SIZE_8KB    = (12 << 1),
+    MPU_SIZE_16KB   = (13 << 1),
+    MPU_SIZE_32KB   = (14 << 1),
+    MPU_SIZE_64KB   = (15 << 1),
+    MPU_SIZE_128KB  = (16 << 1),
+    MPU_SIZE_256KB  = (17 << 1),
+    MPU_SIZE_512KB  = (18 << 1),
+    MPU_SIZE_1MB    = (19 << 1),
+    MPU_SIZE_512MB  = (28 << 1),
+    MPU_SIZE_4GB    = (31 << 1)
+}MPU_size_t;
+
 #define MPU_RASR_XN (0x10000000)
 
 #define MPU_CTRL_ENABLE (0x1)
 #define MPU_RASR_ENABLE (0x1)
 #define MPU_CTRL_DEFAULT_MAP (0x4)
+#define MPU_RBAR_VALID (0x10)
 #define MPU_BASE (0xE000ED90UL)
 
 #define MPU ((MPU_typedef_t *)MPU_BASE)
 
+typedef struct{
+    uint32_t rbar;
+    uint32_t rasr;
+}MPU_region_t;
+
+//region number, base (aligned to size), MPU_size_t, mpu_permissions_t | mpu_texscb_features_t | MPU_RASR_XN
+#define MPU_REGION(num, base, size, attrs) \
+    ((MPU_region_t){ (uint32_t)(base) | MPU_RBAR_VALID | (num), (uint32_t)(attrs) | (size) | MPU_RASR_ENABLE })
+#define MPU_REGION_OFF(num) ((MPU_region_t){ MPU_RBAR_VALID | (num), 0 })
+
+#define MPU_FLASH_BASE      (0x08000000UL)
+#define MPU_PERIPH_BASE     (0x40000000UL)
+#ifndef MPU_STACK_GUARD_SIZE
+#define MPU_STACK_GUARD_SIZE MPU_SIZE_256B
+#endif
+
+extern uint32_t __stack_limit[]; //linker script, lowest address of the main stack
+
 ALWAYS_STATIC void mpu_enable_with_default_map(){
     DMB;
     MPU->CTRL = MPU_CTRL_ENABLE | MPU_CTRL_DEFAULT_MAP;
@@ -247,6 +396,47 @@ ALWAYS_STATIC void mpu_enable_with_default_map(){
     ISB;
 }
 
+ALWAYS_STATIC void mpu_disable(){
+    DMB;
+    MPU->CTRL = 0;
+    DSB;
+    ISB;
+}
+
+//VALID in RBAR selects the region, RNR is not touched
+ALWAYS_STATIC void mpu_set_region(MPU_region_t region){
+    MPU->RBAR = region.rbar;
+    MPU->RASR = region.rasr;
+}
+
+//RBAR/RASR and the three alias pairs are consecutive, one ldm/stm of 8 words programs 4 regions.
+//r7 is left alone since it is the frame pointer at -O0
+ALWAYS_STATIC void mpu_set_regions4(const MPU_region_t regions[4]){
+    __asm volatile(
+        "ldmia %0, {r2-r6,r8,r9,r12}    \n"
+        "stmia %1, {r2-r6,r8,r9,r12}    \n"
+        :
+        : "r"(regions), "r"(&MPU->RBAR)
+        : "r2", "r3", "r4", "r5", "r6", "r8", "r9", "r12", "memory"
+    );
+}
+
+//0: flash read only, 1: peripherals execute never, 2: no access guard at the bottom
+//of the main stack, 3: off (free for the application). RAM stays on the default map,
+//it can't be XN while .ramfunc lives there. Overruns fault at the instruction (MemManage
+//once enabled, HardFault otherwise) instead of running into .noinit/.bss.
+ALWAYS_STATIC void mpu_setup_default_protection(){
+    const MPU_region_t regions[4] = {
+        MPU_REGION(0, MPU_FLASH_BASE, MPU_SIZE_512KB, MPU_AP_PRIV_RO_UNPRIV_RO | MPU_TEXSCB_NORMAL_NO_ALLOCATE_WRT),
+        MPU_REGION(1, MPU_PERIPH_BASE, MPU_SIZE_512MB, MPU_AP_FULL_ACCESS | MPU_TEXSCB_SHARED_DEVICE | MPU_RASR_XN),
+        MPU_REGION(2, __stack_limit, MPU_STACK_GUARD_SIZE, MPU_AP_NO_ACCESS | MPU_RASR_XN),
+        MPU_REGION_OFF(3),
+    };
+    mpu_disable();
+    mpu_set_regions4(regions);
+    mpu_enable_with_default_map();
+}
+
 #endif // BAD_HAL_USE_MPU
 
 #ifdef BAD_HAL_USE_FPU
@@ -270,12 +460,68 @@ typedef enum {
     FPU_FEATURE_ENABLE_LAZY_STACKING = 0x40000000
 }FPU_features_t;
 
+#define FPU_FPCCR_LSPACT (0x1)
+
 ALWAYS_STATIC void fpu_setup( FPU_features_t features){
     FPU->FPCCR = features;
     DSB;
     ISB;
 }
 
+//LSPACT is set while an extended frame is reserved but the float registers aren't saved yet
+ALWAYS_STATIC uint8_t fpu_lazy_pending(){
+    return FPU->FPCCR & FPU_FPCCR_LSPACT;
+}
+
+//FPU_FREE_ISR(x){ ... } marks a handler that must not touch the FPU, so entry stays at
+//the 8 word frame. The body is built general-regs-only, a float in it fails to compile
+//(functions it calls are not checked). With -DBAD_FPU_MEASURE the handler is also
+//wrapped and counts how often it was entered over a float context (fp_entries) and how
+//often it then triggered the lazy save anyway (lazy_saves, should stay 0).
+//Counters are per isr (x##_fpu_stats) and summed in fpu_stats, storage needs
+//BAD_FPU_IMPLEMENTATION in one file.
+#define FPU_FREE __attribute__((target("general-regs-only")))
+
+typedef struct{
+    uint32_t entries;
+    uint32_t fp_entries;
+    uint32_t lazy_saves;
+}FPU_lazy_stats_t;
+
+#ifdef BAD_FPU_MEASURE
+extern FPU_lazy_stats_t fpu_stats;
+
+ALWAYS_INLINE void fpu_stats_update(FPU_lazy_stats_t *stats, uint8_t pending){
+    if (pending) {
+        stats->fp_entries++;
+        fpu_stats.fp_entries++;
+        if (!fpu_lazy_pending()) {
+            stats->lazy_saves++;
+            fpu_stats.lazy_saves++;
+        }
+    }
+    stats->entries++;
+    fpu_stats.entries++;
+}
+
+#define FPU_FREE_ISR(x)                                 \
+    FPU_lazy_stats_t x##_fpu_stats;                     \
+    static void x##_fpu_free(void);                     \
+    BAD_ISR_HOT void x(void){                           \
+        uint8_t pending = fpu_lazy_pending();           \
+        x##_fpu_free();                                 \
+        fpu_stats_update(&x##_fpu_stats, pending);      \
+    }                                                   \
+    static void __attribute__((noinline)) FPU_FREE x##_fpu_free(void)
+
+#ifdef BAD_FPU_IMPLEMENTATION
+FPU_lazy_stats_t fpu_stats;
+#endif
+
+#else
+#define FPU_FREE_ISR(x) FPU_FREE STRONG_ISR(x)
+#endif
+
 #endif // BAD_HAL_USE_FPU
 
 //Flash
@@ -341,6 +587,61 @@ extern inline void flash_acceleration_setup(FLASH_latency_t latency ,FLASH_dcach
 
 extern void rcc_fallback_to_hsi();
 
+//RCC->CSR reset flags shifted down, several can be set at once (POR also sets PIN and BOR)
+typedef enum{
+    RCC_RESET_BOR       = 0x1,
+    RCC_RESET_PIN       = 0x2,
+    RCC_RESET_POR       = 0x4,
+    RCC_RESET_SOFTWARE  = 0x8,
+    RCC_RESET_IWDG      = 0x10,
+    RCC_RESET_WWDG      = 0x20,
+    RCC_RESET_LOW_POWER = 0x40
+}RCC_reset_cause_t;
+
+//Index into the peripheral clock table, see rcc_periph_enable
+typedef enum{
+    RCC_PERIPH_GPIOA = 0,
+    RCC_PERIPH_GPIOB,
+    RCC_PERIPH_GPIOC,
+    RCC_PERIPH_GPIOD,
+    RCC_PERIPH_GPIOE,
+    RCC_PERIPH_GPIOH,
+    RCC_PERIPH_CRC,
+    RCC_PERIPH_DMA1,
+    RCC_PERIPH_DMA2,
+    RCC_PERIPH_USB_OTG_FS,
+    RCC_PERIPH_TIM2,
+    RCC_PERIPH_TIM3,
+    RCC_PERIPH_TIM4,
+    RCC_PERIPH_TIM5,
+    RCC_PERIPH_WWDG,
+    RCC_PERIPH_SPI2,
+    RCC_PERIPH_SPI3,
+    RCC_PERIPH_USART2,
+    RCC_PERIPH_I2C1,
+    RCC_PERIPH_I2C2,
+    RCC_PERIPH_I2C3,
+    RCC_PERIPH_PWR,
+    RCC_PERIPH_TIM1,
+    RCC_PERIPH_USART1,
+    RCC_PERIPH_USART6,
+    RCC_PERIPH_ADC1,
+    RCC_PERIPH_SDIO,
+    RCC_PERIPH_SPI1,
+    RCC_PERIPH_SPI4,
+    RCC_PERIPH_SYSCFG,
+    RCC_PERIPH_TIM9,
+    RCC_PERIPH_TIM10,
+    RCC_PERIPH_TIM11,
+    RCC_PERIPH_SPI5,
+    RCC_PERIPH_COUNT
+}RCC_periph_t;
+
+extern void rcc_periph_enable(RCC_periph_t periph);
+extern void rcc_periph_disable(RCC_periph_t periph);
+extern void rcc_periph_reset(RCC_periph_t periph);
+extern uint8_t rcc_periph_users(RCC_periph_t periph);
+
 #ifdef BAD_RCC_IMPLEMENTATION
 
 typedef struct RCC_regs_t{
@@ -445,6 +746,8 @@ typedef enum{
     RCC_AHB1_GPIOB = 0x2,
     RCC_AHB1_GPIOC = 0x4,
     RCC_AHB1_GPIOD = 0x8,
+    RCC_AHB1_GPIOE = 0x10,
+    RCC_AHB1_GPIOH = 0x80,
     RCC_AHB1_CRCEN = 0x1000,
     RCC_AHB1_DMA1  = 0x200000,
     RCC_AHB1_DMA2  = 0x400000  
@@ -466,7 +769,7 @@ typedef enum{
     RCC_APB1_I2C1   = 0x200000,
     RCC_APB1_I2C2   = 0x400000,
     RCC_APB1_I2C3   = 0x800000,
-    RCC_APB1_PWR    = 0x1000000
+    RCC_APB1_PWR    = 0x10000000
 }RCC_APB1_peripherals_t;
 
 
@@ -491,6 +794,21 @@ typedef enum{
 #define RCC_BASE (0x40023800UL)
 #define RCC ((__IO RCC_typedef_t *)RCC_BASE)
 
+#define RCC_CSR_RMVF (0x1 << 24)
+#define RCC_CSR_LSION (0x1)
+#define RCC_CSR_LSIRDY (0x2)
+#define RCC_BDCR_RTCSEL_MASK (0x300)
+#define RCC_BDCR_RTCSEL_LSI (0x200)
+#define RCC_BDCR_RTCEN (0x8000)
+#define RCC_CSR_RESET_SHIFT (25)
+
+//Flags stay set until cleared, so this reads and clears them for the next reset
+ALWAYS_STATIC RCC_reset_cause_t rcc_reset_cause(void){
+    RCC_reset_cause_t cause = RCC->CSR >> RCC_CSR_RESET_SHIFT;
+    RCC->CSR |= RCC_CSR_RMVF;
+    return cause;
+}
+
 ALWAYS_STATIC void rcc_enable_hsi(void) {
     RCC->CR |= HSION_MASK;
     while (!(RCC->CR & HSIRDY_MASK));
@@ -525,6 +843,119 @@ ALWAYS_STATIC void rcc_set_apb2_clocking(RCC_APB2_peripherals_t apb2_mask){
     RCC->APB2ENR = apb2_mask;
 }
 
+//Reference counted clocks. The rcc_set_*_clocking calls above assign the whole register
+//and wipe these, use them for the boot mask only and before any rcc_periph_enable.
+//Bus is the word offset of the bus from AHB1, the same for *RSTR, *ENR and *LPENR.
+typedef enum{
+    RCC_BUS_AHB1 = 0,
+    RCC_BUS_AHB2 = 1,
+    RCC_BUS_APB1 = 4,
+    RCC_BUS_APB2 = 5
+}RCC_bus_t;
+
+typedef struct{
+    uint8_t bus;
+    uint32_t mask;
+}RCC_periph_desc_t;
+
+static const RCC_periph_desc_t rcc_periph_table[RCC_PERIPH_COUNT] = {
+    [RCC_PERIPH_GPIOA]      = {RCC_BUS_AHB1, RCC_AHB1_GPIOA},
+    [RCC_PERIPH_GPIOB]      = {RCC_BUS_AHB1, RCC_AHB1_GPIOB},
+    [RCC_PERIPH_GPIOC]      = {RCC_BUS_AHB1, RCC_AHB1_GPIOC},
+    [RCC_PERIPH_GPIOD]      = {RCC_BUS_AHB1, RCC_AHB1_GPIOD},
+    [RCC_PERIPH_GPIOE]      = {RCC_BUS_AHB1, RCC_AHB1_GPIOE},
+    [RCC_PERIPH_GPIOH]      = {RCC_BUS_AHB1, RCC_AHB1_GPIOH},
+    [RCC_PERIPH_CRC]        = {RCC_BUS_AHB1, RCC_AHB1_CRCEN},
+    [RCC_PERIPH_DMA1]       = {RCC_BUS_AHB1, RCC_AHB1_DMA1},
+    [RCC_PERIPH_DMA2]       = {RCC_BUS_AHB1, RCC_AHB1_DMA2},
+    [RCC_PERIPH_USB_OTG_FS] = {RCC_BUS_AHB2, RCC_AHB2_USB_OTG_FS},
+    [RCC_PERIPH_TIM2]       = {RCC_BUS_APB1, RCC_APB1_TIM2},
+    [RCC_PERIPH_TIM3]       = {RCC_BUS_APB1, RCC_APB1_TIM3},
+    [RCC_PERIPH_TIM4]       = {RCC_BUS_APB1, RCC_APB1_TIM4},
+    [RCC_PERIPH_TIM5]       = {RCC_BUS_APB1, RCC_APB1_TIM5},
+    [RCC_PERIPH_WWDG]       = {RCC_BUS_APB1, RCC_APB1_WWDG},
+    [RCC_PERIPH_SPI2]       = {RCC_BUS_APB1, RCC_APB1_SPI2},
+    [RCC_PERIPH_SPI3]       = {RCC_BUS_APB1, RCC_APB1_SPI3},
+    [RCC_PERIPH_USART2]     = {RCC_BUS_APB1, RCC_APB1_USART2},
+    [RCC_PERIPH_I2C1]       = {RCC_BUS_APB1, RCC_APB1_I2C1},
+    [RCC_PERIPH_I2C2]       = {RCC_BUS_APB1, RCC_APB1_I2C2},
+    [RCC_PERIPH_I2C3]       = {RCC_BUS_APB1, RCC_APB1_I2C3},
+    [RCC_PERIPH_PWR]        = {RCC_BUS_APB1, RCC_APB1_PWR},
+    [RCC_PERIPH_TIM1]       = {RCC_BUS_APB2, RCC_APB2_TIM1},
+    [RCC_PERIPH_USART1]     = {RCC_BUS_APB2, RCC_APB2_USART1},
+    [RCC_PERIPH_USART6]     = {RCC_BUS_APB2, RCC_APB2_USART6},
+    [RCC_PERIPH_ADC1]       = {RCC_BUS_APB2, RCC_APB2_ADC1}, //ADCRST resets the common registers too
+    [RCC_PERIPH_SDIO]       = {RCC_BUS_APB2, RCC_APB2_SDIO},
+    [RCC_PERIPH_SPI1]       = {RCC_BUS_APB2, RCC_APB2_SPI1},
+    [RCC_PERIPH_SPI4]       = {RCC_BUS_APB2, RCC_APB2_SPI4},
+    [RCC_PERIPH_SYSCFG]     = {RCC_BUS_APB2, RCC_APB2_SYSCFGEN},
+    [RCC_PERIPH_TIM9]       = {RCC_BUS_APB2, RCC_APB2_TIM9},
+    [RCC_PERIPH_TIM10]      = {RCC_BUS_APB2, RCC_APB2_TIM10},
+    [RCC_PERIPH_TIM11]      = {RCC_BUS_APB2, RCC_APB2_TIM11},
+    [RCC_PERIPH_SPI5]       = {RCC_BUS_APB2, RCC_APB2_SPI5},
+};
+
+static uint8_t rcc_periph_refs[RCC_PERIPH_COUNT];
+
+//from the critical section helpers in the NVIC part
+ALWAYS_STATIC uint32_t irq_save();
+ALWAYS_STATIC void irq_restore(uint32_t primask);
+
+//First user turns the clock on, in run and in sleep. The read back is the
+//errata workaround, the peripheral can't be written for 2 bus cycles after the enable.
+extern void rcc_periph_enable(RCC_periph_t periph){
+    const RCC_periph_desc_t *desc = &rcc_periph_table[periph];
+    __IO uint32_t *enr = &RCC->AHB1ENR + desc->bus;
+    __IO uint32_t *lpenr = &RCC->AHB1LPENR + desc->bus;
+    uint32_t primask = irq_save();
+    if (rcc_periph_refs[periph]++ == 0) {
+        *enr |= desc->mask;
+        *lpenr |= desc->mask;
+        (void)*enr;
+    }
+    irq_restore(primask);
+}
+
+//Last user turns it off, unbalanced disables are ignored
+extern void rcc_periph_disable(RCC_periph_t periph){
+    const RCC_periph_desc_t *desc = &rcc_periph_table[periph];
+    __IO uint32_t *enr = &RCC->AHB1ENR + desc->bus;
+    __IO uint32_t *lpenr = &RCC->AHB1LPENR + desc->bus;
+    uint32_t primask = irq_save();
+    if (rcc_periph_refs[periph] && --rcc_periph_refs[periph] == 0) {
+        *enr &= ~desc->mask;
+        *lpenr &= ~desc->mask;
+    }
+    irq_restore(primask);
+}
+
+//All registers back to reset values, the clock stays as it was
+extern void rcc_periph_reset(RCC_periph_t periph){
+    const RCC_periph_desc_t *desc = &rcc_periph_table[periph];
+    __IO uint32_t *rstr = &RCC->AHB1RSTR + desc->bus;
+    uint32_t primask = irq_save();
+    *rstr |= desc->mask;
+    (void)*rstr;
+    *rstr &= ~desc->mask;
+    (void)*rstr;
+    irq_restore(primask);
+}
+
+extern uint8_t rcc_periph_users(RCC_periph_t periph){
+    return rcc_periph_refs[periph];
+}
+
+//*LPENR reset to all on, this keeps only what is enabled running in sleep.
+//Flash interface and SRAM1 stay on so DMA can keep reading buffers while the core sleeps.
+#define RCC_AHB1LPENR_KEEP (0x18000U)
+
+ALWAYS_STATIC void rcc_gate_sleep_clocks(){
+    RCC->AHB1LPENR = RCC->AHB1ENR | RCC_AHB1LPENR_KEEP;
+    RCC->AHB2LPENR = RCC->AHB2ENR;
+    RCC->APB1LPENR = RCC->APB1ENR;
+    RCC->APB2LPENR = RCC->APB2ENR;
+}
+
 ALWAYS_STATIC void rcc_enable_and_switch_to_pll(){
     RCC->CR |= PLLON_MASK;
     while (!(RCC->CR & PLLRDY_MASK));
@@ -632,6 +1063,8 @@ typedef enum
     NVIC_SPI5_INTR                   = 85
 } NVIC_programmable_intr_t;
 
+#define NVIC_INTR_COUNT (86)
+
 typedef enum{
     NVIC_PRIO0 = 0,
     NVIC_PRIO1,
@@ -701,6 +1134,108 @@ ALWAYS_STATIC void nvic_set_interrupt_priority(NVIC_programmable_intr_t intrnum,
     OPT_BARRIER;
 }
 
+typedef struct{
+    NVIC_programmable_intr_t intr;
+    NVIC_prio_t prio;
+}NVIC_prio_entry_t;
+
+// Applies a priority plan, e.g.
+// static const NVIC_prio_entry_t plan[] = {
+//     {NVIC_DMA2_STREAM2_INTR, NVIC_PRIO1},
+//     {NVIC_USART1_INTR,       NVIC_PRIO2},
+//     {NVIC_TIM1_UP_TIM10_INTR,NVIC_PRIO8},
+// };
+// Grouping is set to all preemption bits so every level can nest.
+// Interrupts left out of the plan go to NVIC_PRIO_DEFAULT instead of staying at
+// the reset 0, which nothing preempts and crit_enter can't mask.
+#ifndef NVIC_PRIO_DEFAULT
+#define NVIC_PRIO_DEFAULT (NVIC_PRIO15)
+#endif
+
+ALWAYS_STATIC void nvic_apply_priorities(const NVIC_prio_entry_t *plan, uint8_t len){
+    SCB_set_priority_grouping(SCB_PRIO_GROUP0);
+    for (uint8_t i = 0; i < NVIC_INTR_COUNT; i++){
+        NVIC->IP[i] = NVIC_PRIO_DEFAULT << 4;
+    }
+    for (uint8_t i = 0; i < len; i++){
+        NVIC->IP[plan[i].intr] = plan[i].prio << 4;
+    }
+    DSB;
+    OPT_BARRIER;
+}
+
+//Critical sections
+//BASEPRI masks every interrupt with priority value >= its own, 0 masks nothing
+ALWAYS_STATIC uint32_t basepri_get(){
+    uint32_t basepri;
+    __asm volatile("mrs %0, basepri" : "=r"(basepri));
+    return basepri;
+}
+
+ALWAYS_STATIC void basepri_set(uint32_t basepri){
+    __asm volatile("msr basepri, %0" : : "r"(basepri) : "memory");
+}
+
+// Masks interrupts at or below prio (numerically >= prio), more urgent ones keep
+// running. basepri_max only ever raises the mask so nesting is safe, returns the
+// value crit_exit needs. prio has to be NVIC_PRIO1 or above, use irq_save for 0.
+ALWAYS_STATIC uint32_t crit_enter(NVIC_prio_t prio){
+    uint32_t saved = basepri_get();
+    __asm volatile("msr basepri_max, %0" : : "r"(prio << 4) : "memory");
+    ISB;
+    return saved;
+}
+
+ALWAYS_STATIC void crit_exit(uint32_t saved){
+    basepri_set(saved);
+}
+
+//Nestable global mask, cpsid i that restores the previous PRIMASK
+ALWAYS_STATIC uint32_t irq_save(){
+    uint32_t primask;
+    __asm volatile("mrs %0, primask\n"
+                   "cpsid i" : "=r"(primask) : : "memory");
+    return primask;
+}
+
+ALWAYS_STATIC void irq_restore(uint32_t primask){
+    __asm volatile("msr primask, %0" : : "r"(primask) : "memory");
+}
+
+//CRITICAL_SECTION(NVIC_PRIO4){ ... } the block runs with BASEPRI raised, no early return
+#define CRITICAL_SECTION(prio) \
+    for (uint32_t __crit_saved = crit_enter(prio), __crit_once = 1; __crit_once; crit_exit(__crit_saved), __crit_once = 0)
+
+//Vector table
+//startup copies ivt_table into .rivt (512 byte aligned by the linker script) and
+//points VTOR at it, handlers installed here are entered directly by the core
+typedef void (*isr_handler_t)(void);
+
+#define IVT_CORE_VECTORS (16U)
+#define IVT_CORE_OFFSET  (4U)   //SCB_core_interrupt_t 0 is MemManage, vector 4
+
+extern isr_handler_t __ram_ivt[];
+
+ALWAYS_STATIC uint8_t ivt_in_ram(){
+    return SCB->VTOR == (uint32_t)__ram_ivt;
+}
+
+//Returns the old handler so modes can swap back, takes effect on the next exception entry.
+//The handler does the flag clearing the HAL isr would have done.
+ALWAYS_STATIC isr_handler_t ivt_install(NVIC_programmable_intr_t intr, isr_handler_t handler){
+    isr_handler_t old = __ram_ivt[IVT_CORE_VECTORS + intr];
+    __ram_ivt[IVT_CORE_VECTORS + intr] = handler;
+    DSB;
+    return old;
+}
+
+ALWAYS_STATIC isr_handler_t ivt_install_core(SCB_core_interrupt_t intr, isr_handler_t handler){
+    isr_handler_t old = __ram_ivt[IVT_CORE_OFFSET + intr];
+    __ram_ivt[IVT_CORE_OFFSET + intr] = handler;
+    DSB;
+    return old;
+}
+
 #endif // BAD_HAL_USE_NVIC
 
 //Systick
@@ -740,6 +1275,38 @@ ALWAYS_STATIC void systick_disable(){
 
 #endif // BAD_HAL_USE_SYSTICK
 
+//DWT
+#ifdef BAD_HAL_USE_DWT
+
+typedef struct {
+    __IO uint32_t CTRL;
+    __IO uint32_t CYCCNT;
+    __IO uint32_t CPICNT;
+    __IO uint32_t EXCCNT;
+    __IO uint32_t SLEEPCNT;
+    __IO uint32_t LSUCNT;
+    __IO uint32_t FOLDCNT;
+} DWT_typedef_t;
+
+#define DWT_BASE (0xE0001000UL)
+#define DWT ((DWT_typedef_t *)DWT_BASE)
+
+#define COREDEBUG_DEMCR (*(__IO uint32_t *)0xE000EDFCUL)
+#define COREDEBUG_DEMCR_TRCENA (0x1000000)
+#define DWT_CTRL_CYCCNTENA (0x1)
+
+ALWAYS_STATIC void dwt_cycle_counter_enable(){
+    COREDEBUG_DEMCR |= COREDEBUG_DEMCR_TRCENA;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA;
+}
+
+ALWAYS_STATIC uint32_t dwt_cycles(){
+    return DWT->CYCCNT;
+}
+
+#endif // BAD_HAL_USE_DWT
+
 
 //Peripherals
 //USART
@@ -753,6 +1320,12 @@ ALWAYS_STATIC void systick_disable(){
 #endif
 #endif
 
+#ifdef BAD_USART_RAMFUNC
+#define BAD_USART_HOT ATTR_RAMFUNC
+#else
+#define BAD_USART_HOT
+#endif
+
 
 
 typedef struct USART_regs_t{
@@ -784,6 +1357,7 @@ typedef enum{
      (uint8_t)(((((float)clock/(16*baud)) - (uint16_t)((float)clock/(16*baud)))*16) + 0.5f))
 
 
+#define USART_BRR_921600 USART_CALCULATE_BRR(921600UL,CLOCK_SPEED)
 #define USART_BRR_115200 USART_CALCULATE_BRR(115200UL,CLOCK_SPEED)
 #define USART_BRR_9600 USART_CALCULATE_BRR(9600UL,CLOCK_SPEED)
 #define USART_CR1_USART_ENABLE 0x2000
@@ -860,12 +1434,12 @@ BAD_USART_DEF void uart_disable(__IO USART_typedef_t * USART) {
     USART->CR1 &= ~USART_CR1_USART_ENABLE;
 }
 
-BAD_USART_DEF void uart_putchar_polling(__IO USART_typedef_t* USART,char ch){
+BAD_USART_DEF BAD_USART_HOT void uart_putchar_polling(__IO USART_typedef_t* USART,char ch){
     while (!(USART->SR & USART_SR_TXE)); 
     USART->DR = ch;
 }
 
-BAD_USART_DEF char uart_getchar_polling(__IO USART_typedef_t* USART){
+BAD_USART_DEF BAD_USART_HOT char uart_getchar_polling(__IO USART_typedef_t* USART){
     while(!(USART->SR & USART_SR_RXNE));
     return (char)USART->DR;
 }
@@ -942,8 +1516,17 @@ typedef struct{
 #define GPIOC_BASE      (0x40020800UL)
 #define GPIOC ((__IO GPIO_typedef_t*)GPIOC_BASE)
 
-#define BSSRx_BR(x)     (1<<(x + 16))
-#define BSSRx_BS(x)     (1 << x)
+#define GPIOD_BASE      (0x40020C00UL)
+#define GPIOD ((__IO GPIO_typedef_t*)GPIOD_BASE)
+
+#define GPIOE_BASE      (0x40021000UL)
+#define GPIOE ((__IO GPIO_typedef_t*)GPIOE_BASE)
+
+#define GPIOH_BASE      (0x40021C00UL)
+#define GPIOH ((__IO GPIO_typedef_t*)GPIOH_BASE)
+
+#define BSSRx_BR(x)     (1U<<(x + 16))
+#define BSSRx_BS(x)     (1U << x)
 
 ALWAYS_STATIC void io_pin_set(volatile GPIO_typedef_t *GPIO, uint8_t pin_num){
     GPIO->BSRR = BSSRx_BS(pin_num);
@@ -953,16 +1536,75 @@ ALWAYS_STATIC void io_pin_reset(volatile GPIO_typedef_t *GPIO, uint8_t pin_num){
     GPIO->BSRR = BSSRx_BR(pin_num);
 }
 
+// Pin descriptor with the BSRR words baked in, so set/reset never shift at runtime.
+// IO_PIN_DESC with constant arguments folds to a constant and every helper
+// below becomes a single store (a load + store for read/toggle).
+typedef struct{
+    __IO GPIO_typedef_t *GPIO;
+    uint32_t set;
+    uint32_t reset;
+    uint16_t mask;
+}GPIO_pin_desc_t;
+
+#define IO_PIN_DESC(port, pin) ((const GPIO_pin_desc_t){   \
+    .GPIO = (port),                                         \
+    .set = BSSRx_BS(pin),                                   \
+    .reset = BSSRx_BR(pin),                                 \
+    .mask = (1U << (pin))                                   \
+})
+
+ALWAYS_INLINE void io_desc_set(const GPIO_pin_desc_t pin){
+    pin.GPIO->BSRR = pin.set;
+}
+
+ALWAYS_INLINE void io_desc_reset(const GPIO_pin_desc_t pin){
+    pin.GPIO->BSRR = pin.reset;
+}
+
+ALWAYS_INLINE void io_desc_write(const GPIO_pin_desc_t pin, uint8_t value){
+    pin.GPIO->BSRR = value ? pin.set : pin.reset;
+}
+
+ALWAYS_INLINE void io_desc_toggle(const GPIO_pin_desc_t pin){
+    pin.GPIO->BSRR = (pin.GPIO->ODR & pin.mask) ? pin.reset : pin.set;
+}
+
+ALWAYS_INLINE uint8_t io_desc_read(const GPIO_pin_desc_t pin){
+    return (pin.GPIO->IDR & pin.mask) != 0;
+}
+
+//Port wide helpers, masks are 16 bit pin masks
+ALWAYS_STATIC uint16_t io_port_read(volatile GPIO_typedef_t *GPIO){
+    return GPIO->IDR;
+}
+
+ALWAYS_STATIC void io_port_write(volatile GPIO_typedef_t *GPIO, uint16_t value){
+    GPIO->ODR = value;
+}
+
+ALWAYS_STATIC void io_port_set(volatile GPIO_typedef_t *GPIO, uint16_t mask){
+    GPIO->BSRR = mask;
+}
+
+ALWAYS_STATIC void io_port_reset(volatile GPIO_typedef_t *GPIO, uint16_t mask){
+    GPIO->BSRR = (uint32_t)mask << 16;
+}
+
+//Drives the pins in mask to value in one BSRR store, other pins of the port are untouched
+ALWAYS_STATIC void io_port_write_masked(volatile GPIO_typedef_t *GPIO, uint16_t mask, uint16_t value){
+    GPIO->BSRR = ((uint32_t)(mask & ~value) << 16) | (mask & value);
+}
+
 #ifdef BAD_GPIO_IMPLEMENTATION
-#define MODERx_MASK(x)  (0x3<<(x * 2))
-#define MODERx_SET(val,x)((val & 0x3) <<(x * 2))
-#define OSPEEDRx_SET(val,x) ((val & 0x3)<<(x * 2))
-#define OSPEEDRx_MASK(x) (0x3<<(x * 2))
-#define PUPDRx_SET(val,x) ((val & 0x3)<<(x * 2))
-#define PUPDRx_MASK(x) (0x3<<(x * 2))
-#define OTx_MASK(x) (1 << x )//1 bit field 0-push pull 1-open drain
-#define ODRx_MASK(x)    (1 << x )
-#define OTYPERx_SET(val,x) (val << x)
+#define MODERx_MASK(x)  (0x3U<<(x * 2))
+#define MODERx_SET(val,x)((val & 0x3U) <<(x * 2))
+#define OSPEEDRx_SET(val,x) ((val & 0x3U)<<(x * 2))
+#define OSPEEDRx_MASK(x) (0x3U<<(x * 2))
+#define PUPDRx_SET(val,x) ((val & 0x3U)<<(x * 2))
+#define PUPDRx_MASK(x) (0x3U<<(x * 2))
+#define OTx_MASK(x) (1U << x )//1 bit field 0-push pull 1-open drain
+#define ODRx_MASK(x)    (1U << x )
+#define OTYPERx_SET(val,x) ((uint32_t)val << x)
 
 typedef enum {
     MODER_reset_input = 0b00,
@@ -979,9 +1621,6 @@ typedef enum {
     OSPEEDR_high_speed = 0b11
 }OSPEEDRx_states_t;
 
-#define OSPEEDRx_SET(val,x) ((val & 0x3)<<(x * 2))
-#define OSPEEDRx_MASK(x) (0x3<<(x * 2))
-
 typedef enum {
     PUPDR_no_pull = 0b00,
     PUPDR_pullup = 0b01,
@@ -997,6 +1636,90 @@ typedef enum {
 
 
 
+typedef struct{
+    uint32_t moder_mask;
+    uint32_t moder;
+    uint32_t otyper_mask;
+    uint32_t otyper;
+    uint32_t ospeedr_mask;
+    uint32_t ospeedr;
+    uint32_t pupdr_mask;
+    uint32_t pupdr;
+    uint32_t afrl_mask;
+    uint32_t afrl;
+    uint32_t afrh_mask;
+    uint32_t afrh;
+}GPIO_port_config_t;
+
+// Compile time port configuration, every pin is a (pin, mode, af, speed, pull, type) tuple:
+//
+// static const GPIO_port_config_t spi_port = IO_PORT_CONFIG(
+//     IO_PIN(3, MODER_af, 5, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull),
+//     IO_PIN(5, MODER_af, 5, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull));
+// io_setup_port(GPIOB, &spi_port);
+#define IO_PIN(pin, mode, af, speed, pull, type) (pin, mode, af, speed, pull, type)
+
+#define IO_PIN_MODER_MASK(pin, mode, af, speed, pull, type)     MODERx_MASK(pin)
+#define IO_PIN_MODER(pin, mode, af, speed, pull, type)          MODERx_SET(mode, pin)
+#define IO_PIN_OTYPER_MASK(pin, mode, af, speed, pull, type)    OTx_MASK(pin)
+#define IO_PIN_OTYPER(pin, mode, af, speed, pull, type)         OTYPERx_SET(type, pin)
+#define IO_PIN_OSPEEDR_MASK(pin, mode, af, speed, pull, type)   OSPEEDRx_MASK(pin)
+#define IO_PIN_OSPEEDR(pin, mode, af, speed, pull, type)        OSPEEDRx_SET(speed, pin)
+#define IO_PIN_PUPDR_MASK(pin, mode, af, speed, pull, type)     PUPDRx_MASK(pin)
+#define IO_PIN_PUPDR(pin, mode, af, speed, pull, type)          PUPDRx_SET(pull, pin)
+#define IO_PIN_AFRL_MASK(pin, mode, af, speed, pull, type)      (((pin) < 8 && (mode) == MODER_af) ? (0xFU << (((pin) & 0x7) * 4)) : 0)
+#define IO_PIN_AFRL(pin, mode, af, speed, pull, type)           (((pin) < 8 && (mode) == MODER_af) ? (((af) & 0xFU) << (((pin) & 0x7) * 4)) : 0)
+#define IO_PIN_AFRH_MASK(pin, mode, af, speed, pull, type)      (((pin) >= 8 && (mode) == MODER_af) ? (0xFU << (((pin) & 0x7) * 4)) : 0)
+#define IO_PIN_AFRH(pin, mode, af, speed, pull, type)           (((pin) >= 8 && (mode) == MODER_af) ? (((af) & 0xFU) << (((pin) & 0x7) * 4)) : 0)
+
+#define IO_NARGS(...) IO_NARGS_(__VA_ARGS__,16,15,14,13,12,11,10,9,8,7,6,5,4,3,2,1)
+#define IO_NARGS_(_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,N,...) N
+#define IO_CAT(a,b) IO_CAT_(a,b)
+#define IO_CAT_(a,b) a##b
+
+#define IO_OR(f,...) (IO_CAT(IO_OR_,IO_NARGS(__VA_ARGS__))(f,__VA_ARGS__))
+#define IO_OR_1(f,x)      f x
+#define IO_OR_2(f,x,...)  f x | IO_OR_1(f,__VA_ARGS__)
+#define IO_OR_3(f,x,...)  f x | IO_OR_2(f,__VA_ARGS__)
+#define IO_OR_4(f,x,...)  f x | IO_OR_3(f,__VA_ARGS__)
+#define IO_OR_5(f,x,...)  f x | IO_OR_4(f,__VA_ARGS__)
+#define IO_OR_6(f,x,...)  f x | IO_OR_5(f,__VA_ARGS__)
+#define IO_OR_7(f,x,...)  f x | IO_OR_6(f,__VA_ARGS__)
+#define IO_OR_8(f,x,...)  f x | IO_OR_7(f,__VA_ARGS__)
+#define IO_OR_9(f,x,...)  f x | IO_OR_8(f,__VA_ARGS__)
+#define IO_OR_10(f,x,...) f x | IO_OR_9(f,__VA_ARGS__)
+#define IO_OR_11(f,x,...) f x | IO_OR_10(f,__VA_ARGS__)
+#define IO_OR_12(f,x,...) f x | IO_OR_11(f,__VA_ARGS__)
+#define IO_OR_13(f,x,...) f x | IO_OR_12(f,__VA_ARGS__)
+#define IO_OR_14(f,x,...) f x | IO_OR_13(f,__VA_ARGS__)
+#define IO_OR_15(f,x,...) f x | IO_OR_14(f,__VA_ARGS__)
+#define IO_OR_16(f,x,...) f x | IO_OR_15(f,__VA_ARGS__)
+
+#define IO_PORT_CONFIG(...){                                \
+    .moder_mask   = IO_OR(IO_PIN_MODER_MASK,__VA_ARGS__),   \
+    .moder        = IO_OR(IO_PIN_MODER,__VA_ARGS__),        \
+    .otyper_mask  = IO_OR(IO_PIN_OTYPER_MASK,__VA_ARGS__),  \
+    .otyper       = IO_OR(IO_PIN_OTYPER,__VA_ARGS__),       \
+    .ospeedr_mask = IO_OR(IO_PIN_OSPEEDR_MASK,__VA_ARGS__), \
+    .ospeedr      = IO_OR(IO_PIN_OSPEEDR,__VA_ARGS__),      \
+    .pupdr_mask   = IO_OR(IO_PIN_PUPDR_MASK,__VA_ARGS__),   \
+    .pupdr        = IO_OR(IO_PIN_PUPDR,__VA_ARGS__),        \
+    .afrl_mask    = IO_OR(IO_PIN_AFRL_MASK,__VA_ARGS__),    \
+    .afrl         = IO_OR(IO_PIN_AFRL,__VA_ARGS__),         \
+    .afrh_mask    = IO_OR(IO_PIN_AFRH_MASK,__VA_ARGS__),    \
+    .afrh         = IO_OR(IO_PIN_AFRH,__VA_ARGS__)          \
+}
+
+//One write per register, MODER goes last so outputs come up already configured
+ALWAYS_STATIC void io_setup_port(__IO GPIO_typedef_t *GPIO, const GPIO_port_config_t *cfg){
+    GPIO->AFRL = (GPIO->AFRL & ~cfg->afrl_mask) | cfg->afrl;
+    GPIO->AFRH = (GPIO->AFRH & ~cfg->afrh_mask) | cfg->afrh;
+    GPIO->OTYPER = (GPIO->OTYPER & ~cfg->otyper_mask) | cfg->otyper;
+    GPIO->OSPEEDR = (GPIO->OSPEEDR & ~cfg->ospeedr_mask) | cfg->ospeedr;
+    GPIO->PUPDR = (GPIO->PUPDR & ~cfg->pupdr_mask) | cfg->pupdr;
+    GPIO->MODER = (GPIO->MODER & ~cfg->moder_mask) | cfg->moder;
+}
+
 extern inline void io_setup_pin(__IO GPIO_typedef_t *GPIO, uint8_t pin_num, MODERx_states_t mode, uint8_t af, OSPEEDRx_states_t speed, PUPDRx_states_t pull, OTYPRx_state_t type){
     GPIO->MODER &=~(MODERx_MASK(pin_num));
     GPIO->MODER |= MODERx_SET(mode, pin_num);
@@ -1030,6 +1753,12 @@ extern inline void io_setup_pin(__IO GPIO_typedef_t *GPIO, uint8_t pin_num, MODE
     #define BAD_SPI_DEF extern
 #endif
 
+#ifdef BAD_SPI_RAMFUNC
+#define BAD_SPI_HOT ATTR_RAMFUNC
+#else
+#define BAD_SPI_HOT
+#endif
+
 typedef struct{
     __IO uint32_t CR1;
     __IO uint32_t CR2;
@@ -1134,13 +1863,13 @@ BAD_SPI_DEF void spi_disable(__IO SPI_typedef_t* SPI){
 }
 
 
-BAD_SPI_DEF uint8_t spi_transmit_recieve(__IO SPI_typedef_t *SPI, uint8_t data){
+BAD_SPI_DEF BAD_SPI_HOT uint8_t spi_transmit_recieve(__IO SPI_typedef_t *SPI, uint8_t data){
     SPI->DR = data;
     while (!(SPI->SR & SPI_SR_RXNE_MASK));
     return SPI->DR;
 } 
 
-BAD_SPI_DEF void spi_transmit_only(__IO SPI_typedef_t *SPI, uint8_t data){;     
+BAD_SPI_DEF BAD_SPI_HOT void spi_transmit_only(__IO SPI_typedef_t *SPI, uint8_t data){;     
     SPI->DR = data;
     while (!(SPI->SR & SPI_SR_BSY_MASK));
     while (SPI->SR & SPI_SR_BSY_MASK); 
@@ -1346,29 +2075,206 @@ typedef enum {
     EXTI_TRIGGER_BOTH = EXTI_TRIGGER_RISING | EXTI_TRIGGER_FALLING, // 0x3
 } EXTI_trigger_t;
 
+typedef enum {
+    EXTI_MODE_INTERRUPT = 1,
+    EXTI_MODE_EVENT = 2, //no interrupt, only wakes a WFE
+    EXTI_MODE_BOTH = EXTI_MODE_INTERRUPT | EXTI_MODE_EVENT
+} EXTI_mode_t;
+
+//lines 0-15 are gpio, the rest are wired to internal peripherals (rising edge only)
+typedef enum {
+    EXTI_LINE_PVD = 16,
+    EXTI_LINE_RTC_ALARM = 17,
+    EXTI_LINE_OTG_FS_WKUP = 18,
+    EXTI_LINE_RTC_TAMP_STAMP = 21,
+    EXTI_LINE_RTC_WKUP = 22
+} EXTI_internal_line_t;
+
+#define EXTI_LINE_COUNT     (23)
+#define EXTI_LINES_MASK     (0x7FFFFF)
+#define EXTI_PR_EXTI9_5_mask (0x3E0)
+#define EXTI_PR_EXTI15_10_mask (0xFC00)
+
+typedef void (*exti_callback_t)(uint8_t line);
+
 #define EXTI_BASE   (0x40013C00UL)
 #define EXTI        ((__IO EXTI_typedef_t *)EXTI_BASE)
+
+//IMR is shared by every line, the read-modify-write can't be preempted by
+//another isr masking or unmasking its own line
+ALWAYS_STATIC void exti_mask_line(uint8_t line){
+    uint32_t primask = irq_save();
+    EXTI->IMR &= ~(1U << line);
+    irq_restore(primask);
+}
+
+ALWAYS_STATIC void exti_unmask_line(uint8_t line){
+    uint32_t primask = irq_save();
+    EXTI->IMR |= (1U << line);
+    irq_restore(primask);
+}
+
+ALWAYS_STATIC void exti_clear_pending(uint8_t line){
+    EXTI->PR = 1U << line;
+}
+
+//Sets the pending bit as if the edge happened, line has to be unmasked in IMR or EMR
+ALWAYS_STATIC void exti_software_trigger(uint8_t line){
+    EXTI->SWIER = 1U << line;
+}
+
 BAD_EXTI_DEF void exti_configure_line(uint8_t line, EXTI_trigger_t trigger);
+BAD_EXTI_DEF void exti_configure_line_mode(uint8_t line, EXTI_trigger_t trigger, EXTI_mode_t mode);
 
 #ifdef BAD_EXTI_IMPLEMENTATION
-BAD_EXTI_DEF void exti_configure_line(uint8_t line, EXTI_trigger_t trigger)
+BAD_EXTI_DEF void exti_configure_line_mode(uint8_t line, EXTI_trigger_t trigger, EXTI_mode_t mode)
 {
-    
-    EXTI->RTSR &= ~(1 << line);
-    EXTI->FTSR &= ~(1 << line);
+    uint32_t mask = 1U << line;
+
+    exti_mask_line(line);
+    EXTI->EMR &= ~mask;
 
-    
     if (trigger & EXTI_TRIGGER_RISING)
-        EXTI->RTSR |= (1 << line);
+        EXTI->RTSR |= mask;
+    else
+        EXTI->RTSR &= ~mask;
     if (trigger & EXTI_TRIGGER_FALLING)
-        EXTI->FTSR |= (1 << line);
+        EXTI->FTSR |= mask;
+    else
+        EXTI->FTSR &= ~mask;
+
+    EXTI->PR = mask;
+    if (mode & EXTI_MODE_EVENT)
+        EXTI->EMR |= mask;
+    if (mode & EXTI_MODE_INTERRUPT)
+        exti_unmask_line(line);
+}
 
-    // Unmask the interrupt
-    EXTI->PR  |= (1 << line);
-    EXTI->IMR |= (1 << line);
+BAD_EXTI_DEF void exti_configure_line(uint8_t line, EXTI_trigger_t trigger)
+{
+    exti_configure_line_mode(line, trigger, EXTI_MODE_INTERRUPT);
 }
 #endif
 
+//table lives with BAD_EXTI_DISPATCH_ISR_IMPLEMENTATION
+extern exti_callback_t exti_callbacks[EXTI_LINE_COUNT];
+
+ALWAYS_STATIC void exti_set_callback(uint8_t line, exti_callback_t callback){
+    exti_callbacks[line] = callback;
+}
+
+// Edge capture on top of the dispatch table. Every edge is stored with its DWT
+// cycle count into a ring that main drains, the line is then masked for
+// holdoff cycles. exti_debounce_tick() from a periodic timer isr unmasks it and
+// drops the bounces latched meanwhile, nothing busy waits.
+// Holdoff ends on the first tick after it expired, run the tick at least as
+// often as the shortest holdoff. On unmask the pin is sampled again, a level
+// that changed under the mask is stored as one more event (timestamped at the
+// tick) so encoder counts aren't lost to the dropped pending bit.
+// Events go through a ring.h message ring, the debouncing mask is updated with
+// LDREX/STREX and IMR under irq_save, EXTI vectors and the tick isr can sit at
+// different priorities.
+#ifndef EXTI_CAPTURE_RING_SIZE
+#define EXTI_CAPTURE_RING_SIZE (64) //power of two
+#endif
+
+typedef struct{
+    uint32_t timestamp;
+    uint8_t line;
+    uint8_t level;
+}EXTI_capture_event_t;
+
+BAD_EXTI_DEF void exti_capture_setup(uint8_t line, __IO GPIO_typedef_t *GPIO, uint32_t holdoff_cycles);
+BAD_EXTI_DEF uint8_t exti_capture_pop(EXTI_capture_event_t *event);
+BAD_EXTI_DEF uint32_t exti_capture_dropped();
+BAD_EXTI_DEF void exti_debounce_tick();
+
+#ifdef BAD_EXTI_CAPTURE_IMPLEMENTATION
+#include "ring.h"
+
+RING_MSG_DEFINE(exti_capture_ring, sizeof(EXTI_capture_event_t), EXTI_CAPTURE_RING_SIZE);
+
+static __IO GPIO_typedef_t *exti_capture_port[16];
+static uint32_t exti_holdoff[EXTI_LINE_COUNT];
+static uint32_t exti_release_at[EXTI_LINE_COUNT];
+static uint8_t exti_last_level[EXTI_LINE_COUNT];
+static ring_index_t exti_debouncing;
+
+//a plain |= or &= preempted by another EXTI vector would drop its bit, the line would stay masked
+static BAD_ISR_HOT void exti_debouncing_update(uint32_t set, uint32_t clear){
+    uint32_t old;
+    do {
+        old = exti_debouncing;
+    } while (!ring_cas(&exti_debouncing, old, (old | set) & ~clear));
+}
+
+static uint8_t exti_capture_level(uint8_t line){
+    return line < 16 && exti_capture_port[line] ? (exti_capture_port[line]->IDR >> line) & 0x1 : 0;
+}
+
+static BAD_ISR_HOT void exti_capture_push(uint8_t line, uint32_t now, uint8_t level){
+    uint32_t pos;
+    exti_last_level[line] = level;
+    EXTI_capture_event_t *event = ring_msg_claim(&exti_capture_ring, &pos);
+    if(!event){
+        return;
+    }
+    event->timestamp = now;
+    event->line = line;
+    event->level = level;
+    ring_msg_publish(&exti_capture_ring, pos);
+}
+
+static BAD_ISR_HOT void exti_capture_callback(uint8_t line){
+    uint32_t now = dwt_cycles();
+
+    if(exti_holdoff[line]){
+        exti_mask_line(line);
+        exti_release_at[line] = now + exti_holdoff[line];
+        exti_debouncing_update(1U << line, 0);
+    }
+    exti_capture_push(line, now, exti_capture_level(line));
+}
+
+//GPIO is only used to sample the pin level, pass 0 for internal lines
+BAD_EXTI_DEF void exti_capture_setup(uint8_t line, __IO GPIO_typedef_t *GPIO, uint32_t holdoff_cycles){
+    if(line < 16){
+        exti_capture_port[line] = GPIO;
+    }
+    exti_holdoff[line] = holdoff_cycles;
+    exti_last_level[line] = exti_capture_level(line);
+    exti_set_callback(line, exti_capture_callback);
+}
+
+BAD_EXTI_DEF uint8_t exti_capture_pop(EXTI_capture_event_t *event){
+    return ring_msg_pop(&exti_capture_ring, event, sizeof(*event));
+}
+
+BAD_EXTI_DEF uint32_t exti_capture_dropped(){
+    return ring_msg_dropped(&exti_capture_ring);
+}
+
+BAD_EXTI_DEF void exti_debounce_tick(){
+    uint32_t now = dwt_cycles();
+    uint32_t lines = exti_debouncing;
+    while (lines) {
+        uint8_t line = __builtin_ctz(lines);
+        lines &= lines - 1;
+        if((int32_t)(now - exti_release_at[line]) >= 0){
+            exti_debouncing_update(0, 1U << line);
+            exti_clear_pending(line);
+            //edges from here on latch again, the ones dropped above only show in the level
+            uint8_t level = exti_capture_level(line);
+            exti_unmask_line(line);
+            if(line < 16 && exti_capture_port[line] && level != exti_last_level[line]){
+                exti_capture_push(line, now, level);
+            }
+        }
+    }
+}
+
+#endif
+
 #endif // BAD_HAL_USE_EXTI
 
 //Syscfg
@@ -1417,7 +2323,8 @@ ALWAYS_STATIC void syscfg_set_exti_pin(SYSCFG_EXTI_port_t port, uint8_t pin){
 
 typedef struct {
     __IO uint32_t CR1;
-    uint32_t PADDING0[2];
+    __IO uint32_t CR2;
+    __IO uint32_t SMCR;
     __IO uint32_t DIER;
     __IO uint32_t SR;
     __IO uint32_t EGR;
@@ -1436,11 +2343,22 @@ typedef enum{
     BTIMER_CC = 0x2
 }BTIMER_interrupts_t;
 
+typedef enum{
+    BTIMER_TRGO_RESET = 0x0,
+    BTIMER_TRGO_ENABLE = 0x10,
+    BTIMER_TRGO_UPDATE = 0x20
+}BTIMER_trgo_t; //only on timers with a master mode (TIM1-5)
+
+#define BTIM2_BASE 0x40000000UL
+#define BTIM3_BASE 0x40000400UL
 #define BTIM10_BASE 0x40014400UL
 
+#define BTIM2 ((__IO BTIMER_typedef_t *)BTIM2_BASE)
+#define BTIM3 ((__IO BTIMER_typedef_t *)BTIM3_BASE)
 #define BTIM10 ((__IO BTIMER_typedef_t *)BTIM10_BASE)
 
 #define TIM_CR_CEN 0x1
+#define TIM_CR2_MMS_MASK (0x70)
 
 ALWAYS_STATIC void tim_enable(__IO BTIMER_typedef_t* TIM){
     TIM->CR1 |= TIM_CR_CEN; 
@@ -1450,6 +2368,10 @@ ALWAYS_STATIC void tim_disable(__IO BTIMER_typedef_t* TIM){
     TIM->CR1 &= ~TIM_CR_CEN;
 }
 
+ALWAYS_STATIC void tim_set_trgo(__IO BTIMER_typedef_t* TIM, BTIMER_trgo_t trgo){
+    TIM->CR2 = (TIM->CR2 & ~TIM_CR2_MMS_MASK) | trgo;
+}
+
 BAD_TIMER_DEF void basic_timer_setup(__IO BTIMER_typedef_t* TIM,uint16_t barr,uint16_t bpsc, BTIMER_interrupts_t intr);
 #ifdef BAD_TIMER_IMPLEMENTATION
 BAD_TIMER_DEF void basic_timer_setup(__IO BTIMER_typedef_t* TIM,uint16_t barr,uint16_t bpsc, BTIMER_interrupts_t intr){
@@ -1462,6 +2384,260 @@ BAD_TIMER_DEF void basic_timer_setup(__IO BTIMER_typedef_t* TIM,uint16_t barr,ui
 
 #endif // BAD_HAL_USE_BTIMER
 
+//ADC
+#ifdef BAD_HAL_USE_ADC
+
+#ifndef BAD_ADC_DEF
+#ifdef BAD_ADC_STATIC
+    #define BAD_ADC_DEF ALWAYS_STATIC
+#else
+    #define BAD_ADC_DEF extern
+#endif
+#endif
+
+#ifdef BAD_ADC_RAMFUNC
+#define BAD_ADC_HOT ATTR_RAMFUNC
+#else
+#define BAD_ADC_HOT
+#endif
+
+typedef struct{
+    __IO uint32_t SR;
+    __IO uint32_t CR1;
+    __IO uint32_t CR2;
+    __IO uint32_t SMPR1;
+    __IO uint32_t SMPR2;
+    __IO uint32_t JOFR[4];
+    __IO uint32_t HTR;
+    __IO uint32_t LTR;
+    __IO uint32_t SQR1;
+    __IO uint32_t SQR2;
+    __IO uint32_t SQR3;
+    __IO uint32_t JSQR;
+    __IO uint32_t JDR[4];
+    __IO uint32_t DR;
+}ADC_typedef_t;
+
+typedef struct{
+    __IO uint32_t CSR;
+    __IO uint32_t CCR;
+    __IO uint32_t CDR;
+}ADC_common_typedef_t;
+
+#define ADC1_BASE       (0x40012000UL)
+#define ADC1            ((__IO ADC_typedef_t *)ADC1_BASE)
+#define ADC_COMMON_BASE (0x40012300UL)
+#define ADC_COMMON      ((__IO ADC_common_typedef_t *)ADC_COMMON_BASE)
+
+//ADC1 is hardwired to DMA2 stream 0 (or 4) channel 0
+#define ADC1_DMA            (DMA2)
+#define ADC1_DMA_STREAM     (DMA_STREAM0)
+#define ADC1_DMA_CHANNEL    (DMA_channel0)
+
+typedef enum{
+    ADC_FEATURE_EOC_INTR = 0x20,
+    ADC_FEATURE_SCAN = 0x100,
+    ADC_FEATURE_RES_12bit = 0x0,
+    ADC_FEATURE_RES_10bit = 0x1000000,
+    ADC_FEATURE_RES_8bit = 0x2000000,
+    ADC_FEATURE_RES_6bit = 0x3000000,
+    ADC_FEATURE_OVR_INTR = 0x4000000
+}ADC_feature_t;
+
+typedef enum{
+    ADC_MISC_CONTINUOUS = 0x2,
+    ADC_MISC_DMA = 0x100,
+    ADC_MISC_DMA_CONTINUOUS_REQUESTS = 0x200,
+    ADC_MISC_EOC_EACH_CONVERSION = 0x400,
+    ADC_MISC_ALIGN_LEFT = 0x800
+}ADC_misc_t;
+
+//EXTSEL with EXTEN preset to rising edge, so one value selects the trigger
+#define ADC_EXT_TRIGGER(x) (((x) << 24) | (0x1 << 28))
+typedef enum{
+    ADC_TRIGGER_SOFTWARE = 0x0,
+    ADC_TRIGGER_TIM1_CC1 = ADC_EXT_TRIGGER(0x0),
+    ADC_TRIGGER_TIM1_CC2 = ADC_EXT_TRIGGER(0x1),
+    ADC_TRIGGER_TIM1_CC3 = ADC_EXT_TRIGGER(0x2),
+    ADC_TRIGGER_TIM2_CC2 = ADC_EXT_TRIGGER(0x3),
+    ADC_TRIGGER_TIM2_CC3 = ADC_EXT_TRIGGER(0x4),
+    ADC_TRIGGER_TIM2_CC4 = ADC_EXT_TRIGGER(0x5),
+    ADC_TRIGGER_TIM2_TRGO = ADC_EXT_TRIGGER(0x6),
+    ADC_TRIGGER_TIM3_CC1 = ADC_EXT_TRIGGER(0x7),
+    ADC_TRIGGER_TIM3_TRGO = ADC_EXT_TRIGGER(0x8),
+    ADC_TRIGGER_TIM4_CC4 = ADC_EXT_TRIGGER(0x9),
+    ADC_TRIGGER_TIM5_CC1 = ADC_EXT_TRIGGER(0xA),
+    ADC_TRIGGER_TIM5_CC2 = ADC_EXT_TRIGGER(0xB),
+    ADC_TRIGGER_TIM5_CC3 = ADC_EXT_TRIGGER(0xC),
+    ADC_TRIGGER_EXTI11 = ADC_EXT_TRIGGER(0xF)
+}ADC_trigger_t;
+
+typedef enum{
+    ADC_SMP_3_CYCLES = 0x0,
+    ADC_SMP_15_CYCLES,
+    ADC_SMP_28_CYCLES,
+    ADC_SMP_56_CYCLES,
+    ADC_SMP_84_CYCLES,
+    ADC_SMP_112_CYCLES,
+    ADC_SMP_144_CYCLES,
+    ADC_SMP_480_CYCLES
+}ADC_sample_time_t;
+
+typedef enum{
+    ADC_PRESCALER_div_2 = 0x0,
+    ADC_PRESCALER_div_4 = 0x10000,
+    ADC_PRESCALER_div_6 = 0x20000,
+    ADC_PRESCALER_div_8 = 0x30000
+}ADC_prescaler_t;
+
+#define ADC_MAX_SEQUENCE_LEN    (16)
+#define ADC_CCR_ADCPRE_MASK     (0x30000)
+#define ADC_CR2_ADON            (0x1)
+#define ADC_CR2_SWSTART         (0x40000000)
+#define ADC_SR_EOC              (0x2)
+#define ADC_SR_OVR              (0x20)
+#define ADC_DMA_SETTINGS_CIRC   (DMA_feature_DIR_periph_to_mem|DMA_feature_CIRC|DMA_feature_MINC|\
+                                DMA_feature_PSIZE_half_word|DMA_feature_MSIZE_half_word|\
+                                DMA_feature_PL_high_prio)
+//12 bit samples summed in 16 bit lanes, 16*4095 is the most a lane can hold
+#define ADC_SIMD_CHUNK          (16)
+
+ALWAYS_STATIC void adc_set_prescaler(ADC_prescaler_t prescaler){ //common to all ADCs, APB2/4 keeps it under 36mhz at 100mhz
+    ADC_COMMON->CCR = (ADC_COMMON->CCR & ~ADC_CCR_ADCPRE_MASK) | prescaler;
+}
+
+ALWAYS_STATIC void adc_enable(__IO ADC_typedef_t *ADC){
+    ADC->CR2 |= ADC_CR2_ADON;
+}
+
+ALWAYS_STATIC void adc_disable(__IO ADC_typedef_t *ADC){
+    ADC->CR2 &= ~ADC_CR2_ADON;
+}
+
+ALWAYS_STATIC void adc_software_start(__IO ADC_typedef_t *ADC){
+    ADC->CR2 |= ADC_CR2_SWSTART;
+}
+
+ALWAYS_STATIC uint8_t adc_poll_overrun(__IO ADC_typedef_t *ADC){
+    return (ADC->SR & ADC_SR_OVR) != 0;
+}
+
+ALWAYS_STATIC void adc_clear_overrun(__IO ADC_typedef_t *ADC){
+    ADC->SR = ~ADC_SR_OVR; //rc_w0
+}
+
+ALWAYS_STATIC uint32_t adc_uadd16(uint32_t a, uint32_t b){
+    uint32_t res;
+    __asm ("uadd16 %0, %1, %2" : "=r"(res) : "r"(a), "r"(b));
+    return res;
+}
+
+BAD_ADC_DEF void adc_setup(__IO ADC_typedef_t *ADC, ADC_feature_t features, ADC_misc_t misc, ADC_trigger_t trigger);
+BAD_ADC_DEF void adc_set_sample_time(__IO ADC_typedef_t *ADC, uint8_t channel, ADC_sample_time_t smp);
+BAD_ADC_DEF void adc_set_sequence(__IO ADC_typedef_t *ADC, const uint8_t *channels, uint8_t len);
+BAD_ADC_DEF void adc_start_dma_circular(__IO ADC_typedef_t *ADC, uint16_t *buff, uint16_t len);
+BAD_ADC_DEF void adc_reduce_block(const uint16_t *block, uint16_t frames, uint8_t channels, uint8_t shift, uint16_t *out);
+
+#ifdef BAD_ADC_IMPLEMENTATION
+
+BAD_ADC_DEF void adc_setup(__IO ADC_typedef_t *ADC, ADC_feature_t features, ADC_misc_t misc, ADC_trigger_t trigger){
+    ADC->CR2 = 0;
+    ADC->CR1 = features;
+    ADC->CR2 = misc | trigger;
+}
+
+BAD_ADC_DEF void adc_set_sample_time(__IO ADC_typedef_t *ADC, uint8_t channel, ADC_sample_time_t smp){
+    if(channel >= 10){
+        uint8_t shift = (channel - 10) * 3;
+        ADC->SMPR1 = (ADC->SMPR1 & ~(0x7U << shift)) | (smp << shift);
+    }else{
+        uint8_t shift = channel * 3;
+        ADC->SMPR2 = (ADC->SMPR2 & ~(0x7U << shift)) | (smp << shift);
+    }
+}
+
+//len 1..ADC_MAX_SEQUENCE_LEN, anything else is ignored and the sequence stays as it was
+BAD_ADC_DEF void adc_set_sequence(__IO ADC_typedef_t *ADC, const uint8_t *channels, uint8_t len){
+    uint32_t sqr[3] = {0, 0, 0}; //SQR3 holds ranks 1-6, SQR2 7-12, SQR1 13-16 and the length
+    if (len == 0 || len > ADC_MAX_SEQUENCE_LEN){
+        return;
+    }
+    for (uint8_t rank = 0; rank < len; rank++){
+        sqr[rank / 6] |= (channels[rank] & 0x1FU) << ((rank % 6) * 5);
+    }
+    ADC->SQR3 = sqr[0];
+    ADC->SQR2 = sqr[1];
+    ADC->SQR1 = sqr[2] | ((uint32_t)(len - 1) << 20);
+}
+
+// Buffer holds two halves, dma2_stream0_ht fires when the first one is filled and
+// dma2_stream0_tc when the second one is, so the cpu only wakes up per block.
+BAD_ADC_DEF void adc_start_dma_circular(__IO ADC_typedef_t *ADC, uint16_t *buff, uint16_t len){
+    adc_disable(ADC);
+    ADC->CR2 &= ~(ADC_MISC_DMA | ADC_MISC_DMA_CONTINUOUS_REQUESTS);
+    adc_clear_overrun(ADC);
+    dma_setup_transfer(ADC1_DMA,
+        ADC1_DMA_STREAM,
+        ADC1_DMA_CHANNEL,
+        (uint32_t)buff, len,
+        (uint32_t)&ADC->DR,
+        DMA_enable_HT | DMA_enable_TC,
+        ADC_DMA_SETTINGS_CIRC,
+        0);
+    dma_start_transfer(ADC1_DMA, ADC1_DMA_STREAM);
+    ADC->CR2 |= ADC_MISC_DMA | ADC_MISC_DMA_CONTINUOUS_REQUESTS;
+    adc_enable(ADC);
+}
+
+// Per channel sum of an interleaved scan block, shifted right by shift.
+// shift = log2(frames) averages, frames = 4^n with shift = n oversamples by n bits.
+// Even channel counts on a word aligned block sum two channels per uadd16.
+// More than ADC_MAX_SEQUENCE_LEN channels is ignored, out is left alone.
+BAD_ADC_DEF BAD_ADC_HOT void adc_reduce_block(const uint16_t *block, uint16_t frames, uint8_t channels, uint8_t shift, uint16_t *out){
+    uint32_t acc[ADC_MAX_SEQUENCE_LEN];
+    if (channels > ADC_MAX_SEQUENCE_LEN){
+        return;
+    }
+    for (uint8_t ch = 0; ch < channels; ch++){
+        acc[ch] = 0;
+    }
+
+    uint16_t frame = 0;
+    if(!(channels & 0x1) && !((uint32_t)block & 0x3)){
+        const uint32_t *words = (const uint32_t *)block;
+        uint8_t pairs = channels >> 1;
+        while (frame < frames) {
+            uint16_t chunk_end = frames - frame > ADC_SIMD_CHUNK ? frame + ADC_SIMD_CHUNK : frames;
+            for (uint8_t p = 0; p < pairs; p++){
+                uint32_t lanes = 0;
+                const uint32_t *src = words + frame * pairs + p;
+                for (uint16_t f = frame; f < chunk_end; f++){
+                    lanes = adc_uadd16(lanes, *src);
+                    src += pairs;
+                }
+                acc[2*p] += lanes & 0xFFFF;
+                acc[2*p + 1] += lanes >> 16;
+            }
+            frame = chunk_end;
+        }
+    }else{
+        const uint16_t *src = block;
+        for (; frame < frames; frame++){
+            for (uint8_t ch = 0; ch < channels; ch++){
+                acc[ch] += *src++;
+            }
+        }
+    }
+
+    for (uint8_t ch = 0; ch < channels; ch++){
+        out[ch] = acc[ch] >> shift;
+    }
+}
+
+#endif
+
+#endif // BAD_HAL_USE_ADC
+
 #ifdef BAD_HAL_USE_CRC
 
 typedef struct {
@@ -1480,8 +2656,205 @@ ALWAYS_STATIC void crc_reset(){
     CRC->CR = CRC_CR_RESET;
 }
 
+ALWAYS_STATIC uint32_t crc_calculate(const uint32_t *data, uint32_t len){
+    crc_reset();
+    for (uint32_t i = 0; i < len; i++){
+        CRC->DR = data[i];
+    }
+    return CRC->DR;
+}
+
+#endif
+
+//PWR
+//Idle: WFI sleep with DWT time accounting, sleep-on-exit, stop mode with clock restore.
+//BAD_PWR_IMPLEMENTATION needs BAD_RCC_IMPLEMENTATION in the same file (stop wakes on HSI
+//and rcc_sysclock_setup brings the PLL back) and RCC_APB1_PWR clocked.
+#ifdef BAD_HAL_USE_PWR
+
+#ifndef BAD_PWR_DEF
+#ifdef BAD_PWR_STATIC
+    #define BAD_PWR_DEF ALWAYS_STATIC
+#else
+    #define BAD_PWR_DEF extern
+#endif
+#endif
+
+typedef struct{
+    __IO uint32_t CR;
+    __IO uint32_t CSR;
+}PWR_typedef_t;
+
+typedef struct{
+    __IO uint32_t TR;
+    __IO uint32_t DR;
+    __IO uint32_t CR;
+    __IO uint32_t ISR;
+    __IO uint32_t PRER;
+    __IO uint32_t WUTR;
+    __IO uint32_t CALIBR;
+    __IO uint32_t ALRMAR;
+    __IO uint32_t ALRMBR;
+    __IO uint32_t WPR;
+}RTC_typedef_t;
+
+#define PWR_BASE (0x40007000UL)
+#define PWR ((__IO PWR_typedef_t *)PWR_BASE)
+#define RTC_BASE (0x40002800UL)
+#define RTC ((__IO RTC_typedef_t *)RTC_BASE)
+
+typedef enum{
+    PWR_STOP_MAIN_REGULATOR     = 0x0,
+    PWR_STOP_LOW_POWER_REGULATOR= 0x1,  //LPDS, slower wakeup
+    PWR_STOP_FLASH_POWER_DOWN   = 0x200 //FPDS, slower wakeup
+}PWR_stop_t;
+
+#define PWR_CR_LPDS     (0x1)
+#define PWR_CR_PDDS     (0x2)
+#define PWR_CR_CWUF     (0x4)
+#define PWR_CR_DBP      (0x100)
+#define PWR_CR_FPDS     (0x200)
+
+#define SCB_SCR_SLEEPONEXIT (0x2)
+#define SCB_SCR_SLEEPDEEP   (0x4)
+
+#define RTC_CR_WUCKSEL_MASK (0x7)
+#define RTC_CR_WUCKSEL_DIV16 (0x0)
+#define RTC_CR_WUTE     (0x400)
+#define RTC_CR_WUTIE    (0x4000)
+#define RTC_ISR_WUTWF   (0x4)
+#define RTC_ISR_INIT    (0x80)
+#define RTC_ISR_WUTF    (0x400)
+#define RTC_WAKEUP_TICKS_PER_MS (2) //LSI 32khz / 16, LSI is only +-50% accurate
+
+#define DBGMCU_CR (*(__IO uint32_t *)0xE0042004UL)
+#define DBGMCU_CR_LOW_POWER (0x7) //DBG_SLEEP | DBG_STOP | DBG_STANDBY
+
+typedef struct{
+    uint64_t run_cycles;    //between idle calls, DWT
+    uint64_t sleep_cycles;  //in WFI, the DWT keeps counting in sleep
+    uint32_t sleep_entries;
+    uint32_t stop_entries;
+    uint32_t stop_ms;       //from the RTC wakeup period, the DWT stops in stop mode
+    uint32_t stop_other_wakeups; //stop left through something other than the RTC, time unknown
+}IDLE_stats_t;
+
+extern IDLE_stats_t idle_stats;
+
+//Keeps the debugger attached through WFI/stop, costs power, leave it out of production
+ALWAYS_STATIC void idle_debug_enable(){
+    DBGMCU_CR |= DBGMCU_CR_LOW_POWER;
+}
+
+//Purely interrupt driven apps, the core goes back to sleep after every isr instead of
+//returning to main. No idle_stats, nothing runs in thread mode to count.
+ALWAYS_STATIC void idle_sleep_on_exit(uint8_t enable){
+    if (enable) {
+        SCB->SCR |= SCB_SCR_SLEEPONEXIT;
+    } else {
+        SCB->SCR &= ~SCB_SCR_SLEEPONEXIT;
+    }
+    DSB;
+}
+
+BAD_PWR_DEF void idle_sleep(void);
+BAD_PWR_DEF void idle_stop(PWR_stop_t mode);
+BAD_PWR_DEF void idle_stats_reset(void);
+BAD_PWR_DEF void rtc_wakeup_setup(uint16_t ms);
+BAD_PWR_DEF void rtc_wakeup_clear(void);
+
+//Sleeps until cond is true. cond is checked with interrupts masked so a wakeup between
+//the check and the WFI can't be lost, the waking isr runs right after the WFI.
+//Thread mode only, PRIMASK is given back as it was. Called with interrupts masked the
+//isrs never run, WFI still returns on a pending one, so cond has to be a hardware flag.
+#define IDLE_WAIT_UNTIL(cond)                               \
+    do {                                                    \
+        uint32_t __idle_primask = irq_save();               \
+        while (!(cond)) {                                   \
+            idle_sleep();                                   \
+            irq_restore(__idle_primask);                    \
+            __DISABLE_INTERUPTS;                            \
+        }                                                   \
+        irq_restore(__idle_primask);                        \
+    } while (0)
+
+#ifdef BAD_PWR_IMPLEMENTATION
+
+IDLE_stats_t idle_stats;
+static uint32_t idle_last_exit;
+static uint32_t idle_rtc_period_ms;
+
+BAD_PWR_DEF void idle_stats_reset(void){
+    IDLE_stats_t empty = {0};
+    idle_stats = empty;
+    idle_last_exit = dwt_cycles();
+}
+
+//call with interrupts masked (IDLE_WAIT_UNTIL does), a pending interrupt still wakes WFI
+BAD_PWR_DEF void idle_sleep(void){
+    uint32_t enter = dwt_cycles();
+    DSB;
+    WFI;
+    uint32_t exit = dwt_cycles();
+    idle_stats.run_cycles += enter - idle_last_exit;
+    idle_stats.sleep_cycles += exit - enter;
+    idle_stats.sleep_entries++;
+    idle_last_exit = exit;
+}
+
+//Stop: all clocks off, SRAM and registers kept, wakes on any EXTI line (GPIO, RTC wakeup
+//line 22). Clocks are back on the PLL before the waking isr runs.
+BAD_PWR_DEF void idle_stop(PWR_stop_t mode){
+    uint32_t primask = irq_save();
+    uint32_t enter = dwt_cycles();
+    PWR->CR = (PWR->CR & ~(PWR_CR_PDDS | PWR_CR_LPDS | PWR_CR_FPDS)) | mode | PWR_CR_CWUF;
+    SCB->SCR |= SCB_SCR_SLEEPDEEP;
+    DSB;
+    WFI;
+    SCB->SCR &= ~SCB_SCR_SLEEPDEEP;
+    rcc_sysclock_setup(); //woke up on HSI
+
+    idle_stats.run_cycles += enter - idle_last_exit;
+    idle_stats.stop_entries++;
+    if (RTC->ISR & RTC_ISR_WUTF) {
+        idle_stats.stop_ms += idle_rtc_period_ms;
+    } else {
+        idle_stats.stop_other_wakeups++;
+    }
+    idle_last_exit = dwt_cycles();
+    irq_restore(primask);
+}
+
+//Periodic RTC wakeup off the LSI, 1..32767 ms. Wakes stop through EXTI line 22, the
+//line still has to be set up (exti_configure_line(EXTI_LINE_RTC_WKUP, EXTI_TRIGGER_RISING))
+//and the isr has to call rtc_wakeup_clear.
+BAD_PWR_DEF void rtc_wakeup_setup(uint16_t ms){
+    RCC->CSR |= RCC_CSR_LSION;
+    while (!(RCC->CSR & RCC_CSR_LSIRDY));
+    PWR->CR |= PWR_CR_DBP;
+    if (!(RCC->BDCR & RCC_BDCR_RTCEN)) {
+        RCC->BDCR = (RCC->BDCR & ~RCC_BDCR_RTCSEL_MASK) | RCC_BDCR_RTCSEL_LSI | RCC_BDCR_RTCEN;
+    }
+    RTC->WPR = 0xCA;
+    RTC->WPR = 0x53;
+    RTC->CR &= ~RTC_CR_WUTE;
+    while (!(RTC->ISR & RTC_ISR_WUTWF));
+    RTC->WUTR = (uint32_t)ms * RTC_WAKEUP_TICKS_PER_MS - 1;
+    RTC->CR = (RTC->CR & ~RTC_CR_WUCKSEL_MASK) | RTC_CR_WUCKSEL_DIV16 | RTC_CR_WUTIE | RTC_CR_WUTE;
+    RTC->WPR = 0xFF;
+    rtc_wakeup_clear();
+    idle_rtc_period_ms = ms;
+}
+
+//flags are rc_w0, INIT must be written back as read
+BAD_PWR_DEF void rtc_wakeup_clear(void){
+    RTC->ISR = (~RTC_ISR_WUTF & 0xFFFF & ~RTC_ISR_INIT) | (RTC->ISR & RTC_ISR_INIT);
+}
+
 #endif
 
+#endif // BAD_HAL_USE_PWR
+
 //Interrupts
 //Hardfault interrupt
 //HardFault handler with optional UART logging.
@@ -1581,6 +2954,75 @@ void __attribute__((used)) hardfault_c(uint32_t* stack){
 }
 
 
+#endif
+
+//MemManage, BusFault and UsageFault
+//Own vectors once SCB_enable_fault_handlers is called, unhandled faults are passed on
+//to isr_hardfault with the original EXC_RETURN so its logging/crash capture still works.
+//BAD_FAULT_USE_RECOVER calls fault_usr first, returning 1 skips the faulting instruction
+//(a div by 0 leaves the destination register unchanged). Imprecise and stacking
+//faults are never recoverable, nor are INVSTATE (skipping leaves xPSR.T clear and
+//the return faults again) and NOCP (the float op would be silently dropped).
+#ifdef BAD_FAULT_SPLIT_ISR_IMPLEMENTATION
+
+#ifdef BAD_FAULT_USE_RECOVER
+uint8_t fault_usr(uint32_t *stack, uint32_t cfsr);
+#endif
+
+#define FAULT_UNRECOVERABLE (SCB_CFSR_MUNSTKERR | SCB_CFSR_MSTKERR | SCB_CFSR_MLSPERR | \
+                             SCB_CFSR_IMPRECISERR | SCB_CFSR_UNSTKERR | SCB_CFSR_STKERR | \
+                             SCB_CFSR_LSPERR | SCB_CFSR_INVPC | SCB_CFSR_IBUSERR | SCB_CFSR_IACCVIOL | \
+                             SCB_CFSR_INVSTATE | SCB_CFSR_NOCP)
+
+//Returns 1 when the fault was handled and the exception can return
+uint8_t __attribute__((used)) fault_c(uint32_t *stack){
+#ifdef BAD_FAULT_USE_RECOVER
+    uint32_t ipsr;
+    __asm volatile("mrs %0, ipsr" : "=r"(ipsr));
+    uint32_t mask = (ipsr & 0x1FF) == 4 ? SCB_CFSR_MMFSR_MASK :
+                    (ipsr & 0x1FF) == 5 ? SCB_CFSR_BFSR_MASK : SCB_CFSR_UFSR_MASK;
+    uint32_t cfsr = SCB->CFSR & mask;
+
+    if (!(cfsr & FAULT_UNRECOVERABLE) && fault_usr(stack, cfsr)) {
+        uint16_t op = *(const uint16_t *)stack[6];
+        stack[6] += ((op & 0xE000) == 0xE000 && (op & 0x1800)) ? 4 : 2; //32 bit thumb or 16 bit
+        SCB->CFSR = cfsr; //write 1 to clear
+        return 1;
+    }
+#else
+    UNUSED(stack);
+#endif
+    return 0;
+}
+
+//r0 = frame, lr = EXC_RETURN, r0/lr pushed as a pair to keep the stack 8 byte aligned
+#define FAULT_TRAMPOLINE            \
+    __asm volatile(                 \
+        "tst lr,#4          \n"     \
+        "ite eq             \n"     \
+        "mrseq r0,msp       \n"     \
+        "mrsne r0,psp       \n"     \
+        "push {r0,lr}       \n"     \
+        "bl fault_c         \n"     \
+        "pop {r1,lr}        \n"     \
+        "cmp r0,#0          \n"     \
+        "it ne              \n"     \
+        "bxne lr            \n"     \
+        "b isr_hardfault    \n"     \
+    )
+
+void __attribute__((naked)) isr_memmanage(){
+    FAULT_TRAMPOLINE;
+}
+
+void __attribute__((naked)) isr_busfault(){
+    FAULT_TRAMPOLINE;
+}
+
+void __attribute__((naked)) isr_usagefault(){
+    FAULT_TRAMPOLINE;
+}
+
 #endif
 
 //Systick
@@ -1629,6 +3071,74 @@ STRONG_ISR(spi1_isr){
 //
 
 //DMA interrupts
+#ifdef BAD_DMA_DMA2_STREAM0_ISR_IMPLEMENTATION
+
+#ifdef BAD_DMA_DMA2_STREAM0_USE_FE
+void dma2_stream0_fe(uint16_t offset);
+#endif
+
+#ifdef BAD_DMA_DMA2_STREAM0_USE_DME
+void dma2_stream0_dme(uint16_t offset);
+#endif
+
+#ifdef BAD_DMA_DMA2_STREAM0_USE_TE
+void dma2_stream0_te(uint16_t offset);
+#endif
+
+#ifdef BAD_DMA_DMA2_STREAM0_USE_HT
+void dma2_stream0_ht(uint16_t offset);
+#endif
+
+#ifdef BAD_DMA_DMA2_STREAM0_USE_TC
+void dma2_stream0_tc(uint16_t offset);
+#endif
+
+STRONG_ISR(dma2_stream0_isr){
+    enum DMA_Stream0_flag_LISR {
+        DMA_Stream0_frame_error  = (1UL << 0UL),
+        DMA_Stream0_direct_mode_error= (1UL << 2UL),
+        DMA_Stream0_transfer_error  = (1UL << 3UL),
+        DMA_Stream0_half_transfer  = (1UL << 4UL),
+        DMA_Stream0_transfer_complete  = (1UL << 5UL)
+    };
+
+    if(DMA2->LISR & DMA_Stream0_frame_error){
+        DMA2->LIFCR = DMA_Stream0_frame_error;
+#ifdef BAD_DMA_DMA2_STREAM0_USE_FE
+        dma2_stream0_fe(DMA2->streams[0].NDTR);
+#endif
+    }
+
+    if(DMA2->LISR & DMA_Stream0_direct_mode_error){
+        DMA2->LIFCR = DMA_Stream0_direct_mode_error;
+#ifdef BAD_DMA_DMA2_STREAM0_USE_DME
+        dma2_stream0_dme(DMA2->streams[0].NDTR);
+#endif
+    }
+
+    if(DMA2->LISR & DMA_Stream0_transfer_error){
+        DMA2->LIFCR = DMA_Stream0_transfer_error;
+#ifdef BAD_DMA_DMA2_STREAM0_USE_TE
+        dma2_stream0_te(DMA2->streams[0].NDTR);
+#endif
+    }
+    //circular transfers hit HT before TC, serve them in that order
+    if(DMA2->LISR & DMA_Stream0_half_transfer){
+        DMA2->LIFCR = DMA_Stream0_half_transfer;
+#ifdef BAD_DMA_DMA2_STREAM0_USE_HT
+        dma2_stream0_ht(DMA2->streams[0].NDTR);
+#endif
+    }
+
+    if(DMA2->LISR & DMA_Stream0_transfer_complete){
+        DMA2->LIFCR = DMA_Stream0_transfer_complete;
+#ifdef BAD_DMA_DMA2_STREAM0_USE_TC
+        dma2_stream0_tc(DMA2->streams[0].NDTR);
+#endif
+    }
+}
+#endif
+
 #ifdef BAD_DMA_DMA2_STREAM2_ISR_IMPLEMENTATION
 
 #ifdef BAD_DMA_DMA2_STREAM2_USE_FE
@@ -1784,8 +3294,6 @@ void exti8_usr();
 void exti9_usr();
 #endif
 
-#define EXTI_PR_EXTI9_5_mask (0x3E0)
-
 STRONG_ISR(exti9_5_isr){
     enum EXTI9_5_masks{
         EXTI_PR_EXTI5 = 0x20,
@@ -1835,6 +3343,79 @@ STRONG_ISR(exti9_5_isr){
 #endif
 //
 
+// All EXTI vectors through one callback table, the pending lines of a vector
+// are cleared in one store and served lowest line first via ctz (rbit+clz)
+#ifdef BAD_EXTI_DISPATCH_ISR_IMPLEMENTATION
+
+DEFAULT_USER_ISR(exti_callback,uint8_t line){
+    UNUSED(line);
+}
+
+exti_callback_t exti_callbacks[EXTI_LINE_COUNT] = {
+    [0 ... EXTI_LINE_COUNT - 1] = exti_callback_default
+};
+
+ALWAYS_STATIC BAD_ISR_HOT void exti_dispatch(uint32_t lines){
+    uint32_t pending = EXTI->PR & lines;
+    EXTI->PR = pending;
+    while (pending) {
+        uint8_t line = __builtin_ctz(pending);
+        pending &= pending - 1;
+        exti_callbacks[line](line);
+    }
+}
+
+STRONG_ISR(exti0_isr){
+    exti_dispatch(1U << 0);
+}
+
+STRONG_ISR(exti1_isr){
+    exti_dispatch(1U << 1);
+}
+
+STRONG_ISR(exti2_isr){
+    exti_dispatch(1U << 2);
+}
+
+STRONG_ISR(exti3_isr){
+    exti_dispatch(1U << 3);
+}
+
+STRONG_ISR(exti4_isr){
+    exti_dispatch(1U << 4);
+}
+
+STRONG_ISR(exti9_5_isr){
+    exti_dispatch(EXTI_PR_EXTI9_5_mask);
+}
+
+STRONG_ISR(exti15_10_isr){
+    exti_dispatch(EXTI_PR_EXTI15_10_mask);
+}
+
+STRONG_ISR(pvd_isr){
+    exti_dispatch(1U << EXTI_LINE_PVD);
+}
+
+STRONG_ISR(rtc_alarm_isr){
+    exti_dispatch(1U << EXTI_LINE_RTC_ALARM);
+}
+
+STRONG_ISR(otg_fs_wkup_isr){
+    exti_dispatch(1U << EXTI_LINE_OTG_FS_WKUP);
+}
+
+STRONG_ISR(tamp_stamp_isr){
+    exti_dispatch(1U << EXTI_LINE_RTC_TAMP_STAMP);
+}
+
+STRONG_ISR(rtc_wkup_isr){
+    exti_dispatch(1U << EXTI_LINE_RTC_WKUP);
+}
+
+#endif
+//
+
 //Timer interrupts
 #ifdef BTIMER_TIM1_UP_TIM10_ISR_IMPLEMENTATION
 
@@ -0,0 +1,223 @@
+/**
+ * @file crash.h
+ * @brief Header only crash capture, the fault handler snapshots and resets
+ *
+ * isr_hardfault copies the exception frame, the fault status registers and
+ * the top of the faulting stack into the retained.h block, bumps its crash
+ * count and last fault fields and resets right away, nothing is printed from
+ * fault context. The next boot validates the block and dumps the snapshot
+ * over an already configured UART with CFSR decoded to text.
+ *
+ * Usage:
+ *  #define BAD_USART_IMPLEMENTATION
+ *  #define BAD_RETAINED_IMPLEMENTATION
+ *  #define BAD_CRASH_IMPLEMENTATION
+ *  #include "crash.h"
+ *
+ *  // after the clocks (CRC included) and the UART are up
+ *  retained_init();
+ *  if (crash_pending()) {
+ *      crash_dump(USART1);
+ *      crash_clear();
+ *  }
+ *
+ * Notes:
+ *  - Provides isr_hardfault, don't also define BAD_HARDFAULT_ISR_IMPLEMENTATION.
+ *  - `RETAINED_CRASH_STACK_WORDS` (default 32) words of the faulting code's
+ *    stack are kept, fewer if the stack ends before that. An extended (FPU)
+ *    frame and the alignment pad are skipped, so this is the caller's stack.
+ *  - The capture turns the CRC clock on itself, see retained_record_fault.
+ */
+
+#pragma once
+#ifndef BAD_CRASH_H
+#define BAD_CRASH_H
+
+#include "retained.h"
+
+#if defined(BAD_CRASH_IMPLEMENTATION) && defined(BAD_HARDFAULT_ISR_IMPLEMENTATION)
+#error "crash.h provides isr_hardfault, drop BAD_HARDFAULT_ISR_IMPLEMENTATION"
+#endif
+
+#define CRASH_FRAME_WORDS           (8)
+#define CRASH_FRAME_FP_WORDS        (18)        //s0-s15, fpscr, reserved
+#define CRASH_EXC_RETURN_BASIC      (1UL << 4)  //clear: extended frame with FP state
+#define CRASH_XPSR_ALIGN_PAD        (1UL << 9)  //a pad word was pushed above the frame
+
+typedef enum{
+    CRASH_FRAME_R0 = 0,
+    CRASH_FRAME_R1,
+    CRASH_FRAME_R2,
+    CRASH_FRAME_R3,
+    CRASH_FRAME_R12,
+    CRASH_FRAME_LR,
+    CRASH_FRAME_PC,
+    CRASH_FRAME_XPSR
+}CRASH_frame_reg_t;
+
+extern uint8_t crash_pending(void);
+extern void crash_clear(void);
+extern void crash_dump(__IO USART_typedef_t *USART);
+extern void __attribute__((noreturn)) crash_capture(uint32_t *stack, uint32_t exc_return);
+
+#ifdef BAD_CRASH_IMPLEMENTATION
+
+extern unsigned int __eram;
+
+static uint8_t crash_in_ram(uint32_t addr, uint32_t bytes){
+    return addr >= 0x20000000UL && addr + bytes <= (uint32_t)&__eram && !(addr & 0x3);
+}
+
+void __attribute__((naked)) isr_hardfault(){
+    __asm volatile(
+        "cpsid i        \n"
+        "tst lr,#4      \n"
+        "ite eq         \n"
+        "mrseq r0,msp   \n"
+        "mrsne r0,psp   \n"
+        "mov r1,lr      \n"
+        "b crash_capture\n"
+    );
+}
+
+//fault context, no UART and no function that could fault again, reset when done
+extern void __attribute__((noreturn, used)) crash_capture(uint32_t *stack, uint32_t exc_return){
+    retained_crash_t *crash = &retained.block.crash;
+    uint32_t sp = (uint32_t)stack;
+    uint32_t ipsr;
+    __asm volatile("mrs %0, ipsr" : "=r"(ipsr));
+
+    //a stack overflow leaves sp outside RAM, reading it would lock the core up
+    uint8_t frame_ok = crash_in_ram(sp, CRASH_FRAME_WORDS * sizeof(uint32_t));
+    retained_record_fault(frame_ok ? stack[CRASH_FRAME_PC] : 0, SCB->CFSR);
+
+    crash->exc_return = exc_return;
+    crash->ipsr = ipsr & 0x1FF;
+    crash->sp = sp;
+    crash->cfsr = SCB->CFSR;
+    crash->hfsr = SCB->HFSR;
+    crash->mmfar = SCB->MMFAR;
+    crash->bfar = SCB->BFAR;
+    crash->afsr = SCB->AFSR;
+    crash->dfsr = SCB->DFSR;
+    crash->stack_words = 0;
+
+    if (frame_ok) {
+        for (uint32_t i = 0; i < CRASH_FRAME_WORDS; i++) {
+            crash->frame[i] = stack[i];
+        }
+        uint32_t skip = CRASH_FRAME_WORDS;
+        if (!(exc_return & CRASH_EXC_RETURN_BASIC)) {
+            skip += CRASH_FRAME_FP_WORDS;
+        }
+        if (stack[CRASH_FRAME_XPSR] & CRASH_XPSR_ALIGN_PAD) {
+            skip++;
+        }
+        uint32_t above = ((uint32_t)&__eram - sp) / sizeof(uint32_t);
+        uint32_t words = above > skip ? above - skip : 0;
+        if (words > RETAINED_CRASH_STACK_WORDS) {
+            words = RETAINED_CRASH_STACK_WORDS;
+        }
+        for (uint32_t i = 0; i < words; i++) {
+            crash->stack[i] = stack[skip + i];
+        }
+        crash->stack_words = words;
+    } else {
+        for (uint32_t i = 0; i < CRASH_FRAME_WORDS; i++) {
+            crash->frame[i] = 0;
+        }
+    }
+    retained.block.crash_pending = 1;
+    retained_commit();
+    DSB;
+    SCB_system_reset();
+}
+
+//valid after retained_init, a block that failed its CRC was cleared there
+extern uint8_t crash_pending(void){
+    return retained.block.crash_pending;
+}
+
+extern void crash_clear(void){
+    retained.block.crash_pending = 0;
+    retained_commit();
+}
+
+#define CRASH_CFSR_BIT(bit) {SCB_CFSR_##bit, #bit " "}
+
+static const struct{
+    uint32_t mask;
+    const char *name;
+}crash_cfsr_bits[] = {
+    CRASH_CFSR_BIT(IACCVIOL),       //MemManage
+    CRASH_CFSR_BIT(DACCVIOL),
+    CRASH_CFSR_BIT(MUNSTKERR),
+    CRASH_CFSR_BIT(MSTKERR),
+    CRASH_CFSR_BIT(MLSPERR),
+    CRASH_CFSR_BIT(MMARVALID),
+    CRASH_CFSR_BIT(IBUSERR),        //BusFault
+    CRASH_CFSR_BIT(PRECISERR),
+    CRASH_CFSR_BIT(IMPRECISERR),
+    CRASH_CFSR_BIT(UNSTKERR),
+    CRASH_CFSR_BIT(STKERR),
+    CRASH_CFSR_BIT(LSPERR),
+    CRASH_CFSR_BIT(BFARVALID),
+    CRASH_CFSR_BIT(UNDEFINSTR),     //UsageFault
+    CRASH_CFSR_BIT(INVSTATE),
+    CRASH_CFSR_BIT(INVPC),
+    CRASH_CFSR_BIT(NOCP),
+    CRASH_CFSR_BIT(UNALIGNED),
+    CRASH_CFSR_BIT(DIVBYZERO),
+};
+
+static void crash_dump_reg(__IO USART_typedef_t *USART, const char *name, uint32_t value){
+    uart_send_str_polling(USART, name);
+    uart_send_hex_32bit(USART, value);
+}
+
+//Run it with the UART at a high baud (USART_BRR_921600), it's polling
+extern void crash_dump(__IO USART_typedef_t *USART){
+    static const char *frame_names[CRASH_FRAME_WORDS] = {
+        "R0 = ", "R1 = ", "R2 = ", "R3 = ", "R12 = ", "LR = ", "PC = ", "xPSR = "
+    };
+    const retained_crash_t *crash = &retained.block.crash;
+
+    uart_send_str_polling(USART, "CRASH ");
+    uart_send_dec_unsigned_32bit(USART, retained.block.crash_count);
+    uart_send_str_polling(USART, "IN EXCEPTION ");
+    uart_send_dec_unsigned_32bit(USART, crash->ipsr);
+    uart_send_str_polling(USART, "CFSR: ");
+    for (uint32_t i = 0; i < sizeof(crash_cfsr_bits) / sizeof(crash_cfsr_bits[0]); i++) {
+        if (crash->cfsr & crash_cfsr_bits[i].mask) {
+            uart_send_str_polling(USART, crash_cfsr_bits[i].name);
+        }
+    }
+    if (crash->hfsr & (1UL << 30)) {
+        uart_send_str_polling(USART, "FORCED ");
+    }
+    if (!(crash->exc_return & CRASH_EXC_RETURN_BASIC)) {
+        uart_send_str_polling(USART, "FP FRAME ");
+    }
+    uart_send_str_polling(USART, "\r\n");
+
+    for (uint32_t i = 0; i < CRASH_FRAME_WORDS; i++) {
+        crash_dump_reg(USART, frame_names[i], crash->frame[i]);
+    }
+    crash_dump_reg(USART, "SP = ", crash->sp);
+    crash_dump_reg(USART, "EXC_RETURN = ", crash->exc_return);
+    crash_dump_reg(USART, "CFSR = ", crash->cfsr);
+    crash_dump_reg(USART, "HFSR = ", crash->hfsr);
+    crash_dump_reg(USART, "DFSR = ", crash->dfsr);
+    crash_dump_reg(USART, "MMFAR = ", crash->mmfar);
+    crash_dump_reg(USART, "BFAR = ", crash->bfar);
+    crash_dump_reg(USART, "AFSR = ", crash->afsr);
+
+    uart_send_str_polling(USART, "STACK\r\n");
+    for (uint32_t i = 0; i < crash->stack_words; i++) {
+        uart_send_hex_32bit(USART, crash->stack[i]);
+    }
+}
+
+#endif
+
+#endif
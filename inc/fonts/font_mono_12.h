@@ -0,0 +1,1638 @@
+// Generated by tools/font_convert.py from DejaVuSansMono.ttf, size 12, 1 bpp, don't edit
+// 7x16 cell, chars 0x20-0x7E, 1520 bytes
+#pragma once
+#ifndef BAD_FONT_FONT_MONO_12_H
+#define BAD_FONT_FONT_MONO_12_H
+
+#include "ili9341_text.h"
+
+static const uint8_t font_mono_12_glyphs[1520] = {
+    // ' '
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // '!'
+    0x00,
+    0x00,
+    0x00,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x00,
+    0x10,
+    0x10,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // '"'
+    0x00,
+    0x00,
+    0x00,
+    0x28,
+    0x28,
+    0x28,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // '#'
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x14,
+    0x14,
+    0x7E,
+    0x28,
+    0x28,
+    0xFE,
+    0x48,
+    0x50,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // '$'
+    0x00,
+    0x00,
+    0x00,
+    0x10,
+    0x38,
+    0x74,
+    0x50,
+    0x30,
+    0x1C,
+    0x14,
+    0x54,
+    0x3C,
+    0x10,
+    0x10,
+    0x00,
+    0x00,
+    // '%'
+    0x00,
+    0x00,
+    0x00,
+    0x60,
+    0x90,
+    0x90,
+    0x64,
+    0x10,
+    0x4C,
+    0x12,
+    0x12,
+    0x0C,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // '&'
+    0x00,
+    0x00,
+    0x00,
+    0x38,
+    0x60,
+    0x60,
+    0x20,
+    0x70,
+    0x52,
+    0x8A,
+    0x44,
+    0x3A,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // '''
+    0x00,
+    0x00,
+    0x00,
+    0x10,
+    0x10,
+    0x10,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // '('
+    0x00,
+    0x00,
+    0x08,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x08,
+    0x00,
+    0x00,
+    0x00,
+    // ')'
+    0x00,
+    0x00,
+    0x20,
+    0x10,
+    0x10,
+    0x10,
+    0x08,
+    0x08,
+    0x08,
+    0x10,
+    0x10,
+    0x10,
+    0x20,
+    0x00,
+    0x00,
+    0x00,
+    // '*'
+    0x00,
+    0x00,
+    0x00,
+    0x10,
+    0x54,
+    0x38,
+    0x38,
+    0x54,
+    0x10,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // '+'
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x10,
+    0x10,
+    0x10,
+    0x7E,
+    0x10,
+    0x10,
+    0x10,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // ','
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x10,
+    0x10,
+    0x10,
+    0x00,
+    0x00,
+    0x00,
+    // '-'
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x38,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // '.'
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x10,
+    0x10,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // '/'
+    0x00,
+    0x00,
+    0x00,
+    0x04,
+    0x04,
+    0x08,
+    0x08,
+    0x10,
+    0x10,
+    0x20,
+    0x20,
+    0x40,
+    0x40,
+    0x00,
+    0x00,
+    0x00,
+    // '0'
+    0x00,
+    0x00,
+    0x00,
+    0x38,
+    0x64,
+    0x44,
+    0x44,
+    0x54,
+    0x44,
+    0x44,
+    0x64,
+    0x38,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // '1'
+    0x00,
+    0x00,
+    0x00,
+    0x78,
+    0x18,
+    0x18,
+    0x18,
+    0x18,
+    0x18,
+    0x18,
+    0x18,
+    0x3C,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // '2'
+    0x00,
+    0x00,
+    0x00,
+    0x38,
+    0x4C,
+    0x04,
+    0x04,
+    0x08,
+    0x10,
+    0x30,
+    0x60,
+    0x7C,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // '3'
+    0x00,
+    0x00,
+    0x00,
+    0x38,
+    0x44,
+    0x04,
+    0x0C,
+    0x38,
+    0x04,
+    0x04,
+    0x44,
+    0x38,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // '4'
+    0x00,
+    0x00,
+    0x00,
+    0x08,
+    0x18,
+    0x18,
+    0x28,
+    0x48,
+    0x48,
+    0x7E,
+    0x08,
+    0x08,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // '5'
+    0x00,
+    0x00,
+    0x00,
+    0x7C,
+    0x40,
+    0x40,
+    0x78,
+    0x0C,
+    0x04,
+    0x04,
+    0x4C,
+    0x38,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // '6'
+    0x00,
+    0x00,
+    0x00,
+    0x38,
+    0x64,
+    0x40,
+    0x58,
+    0x64,
+    0x44,
+    0x44,
+    0x64,
+    0x38,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // '7'
+    0x00,
+    0x00,
+    0x00,
+    0x7C,
+    0x04,
+    0x0C,
+    0x08,
+    0x08,
+    0x10,
+    0x10,
+    0x10,
+    0x20,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // '8'
+    0x00,
+    0x00,
+    0x00,
+    0x38,
+    0x64,
+    0x44,
+    0x64,
+    0x38,
+    0x44,
+    0x44,
+    0x44,
+    0x38,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // '9'
+    0x00,
+    0x00,
+    0x00,
+    0x38,
+    0x44,
+    0x44,
+    0x44,
+    0x44,
+    0x3C,
+    0x04,
+    0x0C,
+    0x38,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // ':'
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x10,
+    0x10,
+    0x00,
+    0x00,
+    0x10,
+    0x10,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // ';'
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x10,
+    0x10,
+    0x00,
+    0x00,
+    0x10,
+    0x10,
+    0x10,
+    0x00,
+    0x00,
+    0x00,
+    // '<'
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x06,
+    0x1C,
+    0x60,
+    0x60,
+    0x1C,
+    0x06,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // '='
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x7E,
+    0x00,
+    0x7E,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // '>'
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x40,
+    0x30,
+    0x0C,
+    0x0C,
+    0x30,
+    0x40,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // '?'
+    0x00,
+    0x00,
+    0x00,
+    0x38,
+    0x04,
+    0x04,
+    0x08,
+    0x10,
+    0x10,
+    0x00,
+    0x10,
+    0x10,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // '@'
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x3C,
+    0x64,
+    0x42,
+    0x9E,
+    0x92,
+    0x92,
+    0x9E,
+    0x40,
+    0x60,
+    0x1C,
+    0x00,
+    0x00,
+    // 'A'
+    0x00,
+    0x00,
+    0x00,
+    0x10,
+    0x38,
+    0x28,
+    0x28,
+    0x2C,
+    0x44,
+    0x7C,
+    0x46,
+    0xC2,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 'B'
+    0x00,
+    0x00,
+    0x00,
+    0x78,
+    0x44,
+    0x44,
+    0x44,
+    0x78,
+    0x44,
+    0x46,
+    0x44,
+    0x7C,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 'C'
+    0x00,
+    0x00,
+    0x00,
+    0x1C,
+    0x20,
+    0x40,
+    0x40,
+    0x40,
+    0x40,
+    0x40,
+    0x20,
+    0x1C,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 'D'
+    0x00,
+    0x00,
+    0x00,
+    0x78,
+    0x4C,
+    0x44,
+    0x44,
+    0x44,
+    0x44,
+    0x44,
+    0x4C,
+    0x78,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 'E'
+    0x00,
+    0x00,
+    0x00,
+    0x7C,
+    0x40,
+    0x40,
+    0x40,
+    0x7C,
+    0x40,
+    0x40,
+    0x40,
+    0x7C,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 'F'
+    0x00,
+    0x00,
+    0x00,
+    0x7E,
+    0x60,
+    0x60,
+    0x60,
+    0x7C,
+    0x60,
+    0x60,
+    0x60,
+    0x60,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 'G'
+    0x00,
+    0x00,
+    0x00,
+    0x3C,
+    0x60,
+    0x40,
+    0x40,
+    0x4C,
+    0x44,
+    0x44,
+    0x64,
+    0x3C,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 'H'
+    0x00,
+    0x00,
+    0x00,
+    0x44,
+    0x44,
+    0x44,
+    0x44,
+    0x7C,
+    0x44,
+    0x44,
+    0x44,
+    0x44,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 'I'
+    0x00,
+    0x00,
+    0x00,
+    0x7C,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x7C,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 'J'
+    0x00,
+    0x00,
+    0x00,
+    0x3C,
+    0x0C,
+    0x0C,
+    0x0C,
+    0x0C,
+    0x0C,
+    0x0C,
+    0x08,
+    0x78,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 'K'
+    0x00,
+    0x00,
+    0x00,
+    0x46,
+    0x4C,
+    0x58,
+    0x70,
+    0x70,
+    0x48,
+    0x4C,
+    0x44,
+    0x46,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 'L'
+    0x00,
+    0x00,
+    0x00,
+    0x40,
+    0x40,
+    0x40,
+    0x40,
+    0x40,
+    0x40,
+    0x40,
+    0x40,
+    0x7E,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 'M'
+    0x00,
+    0x00,
+    0x00,
+    0xC6,
+    0xE6,
+    0xEE,
+    0xEA,
+    0xDA,
+    0xD2,
+    0xC2,
+    0xC2,
+    0xC2,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 'N'
+    0x00,
+    0x00,
+    0x00,
+    0x64,
+    0x64,
+    0x64,
+    0x54,
+    0x54,
+    0x4C,
+    0x4C,
+    0x4C,
+    0x44,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 'O'
+    0x00,
+    0x00,
+    0x00,
+    0x38,
+    0x64,
+    0x44,
+    0x44,
+    0x46,
+    0x44,
+    0x44,
+    0x64,
+    0x38,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 'P'
+    0x00,
+    0x00,
+    0x00,
+    0x7C,
+    0x44,
+    0x46,
+    0x44,
+    0x7C,
+    0x40,
+    0x40,
+    0x40,
+    0x40,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 'Q'
+    0x00,
+    0x00,
+    0x00,
+    0x38,
+    0x64,
+    0x44,
+    0x44,
+    0x46,
+    0x44,
+    0x44,
+    0x64,
+    0x38,
+    0x0C,
+    0x04,
+    0x00,
+    0x00,
+    // 'R'
+    0x00,
+    0x00,
+    0x00,
+    0x78,
+    0x44,
+    0x44,
+    0x44,
+    0x78,
+    0x4C,
+    0x44,
+    0x46,
+    0x42,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 'S'
+    0x00,
+    0x00,
+    0x00,
+    0x38,
+    0x44,
+    0x40,
+    0x60,
+    0x38,
+    0x04,
+    0x04,
+    0x44,
+    0x38,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 'T'
+    0x00,
+    0x00,
+    0x00,
+    0xFE,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 'U'
+    0x00,
+    0x00,
+    0x00,
+    0x44,
+    0x44,
+    0x44,
+    0x44,
+    0x44,
+    0x44,
+    0x44,
+    0x44,
+    0x38,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 'V'
+    0x00,
+    0x00,
+    0x00,
+    0xC2,
+    0x44,
+    0x44,
+    0x44,
+    0x24,
+    0x28,
+    0x28,
+    0x38,
+    0x10,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 'W'
+    0x00,
+    0x00,
+    0x00,
+    0x82,
+    0x82,
+    0x92,
+    0x5A,
+    0x4A,
+    0x6C,
+    0x6C,
+    0x6C,
+    0x64,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 'X'
+    0x00,
+    0x00,
+    0x00,
+    0x46,
+    0x64,
+    0x28,
+    0x18,
+    0x18,
+    0x38,
+    0x2C,
+    0x44,
+    0xC2,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 'Y'
+    0x00,
+    0x00,
+    0x00,
+    0xC6,
+    0x44,
+    0x2C,
+    0x38,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 'Z'
+    0x00,
+    0x00,
+    0x00,
+    0x7E,
+    0x04,
+    0x0C,
+    0x08,
+    0x10,
+    0x10,
+    0x20,
+    0x40,
+    0x7E,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // '['
+    0x00,
+    0x00,
+    0x18,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x18,
+    0x00,
+    0x00,
+    0x00,
+    // 'backslash'
+    0x00,
+    0x00,
+    0x00,
+    0x40,
+    0x40,
+    0x20,
+    0x20,
+    0x10,
+    0x10,
+    0x08,
+    0x08,
+    0x04,
+    0x04,
+    0x00,
+    0x00,
+    0x00,
+    // ']'
+    0x00,
+    0x00,
+    0x38,
+    0x18,
+    0x18,
+    0x18,
+    0x18,
+    0x18,
+    0x18,
+    0x18,
+    0x18,
+    0x18,
+    0x38,
+    0x00,
+    0x00,
+    0x00,
+    // '^'
+    0x00,
+    0x00,
+    0x00,
+    0x18,
+    0x28,
+    0x44,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // '_'
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0xFE,
+    0x00,
+    // '`'
+    0x00,
+    0x00,
+    0x20,
+    0x10,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 'a'
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x78,
+    0x04,
+    0x04,
+    0x3C,
+    0x44,
+    0x44,
+    0x34,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 'b'
+    0x00,
+    0x00,
+    0x40,
+    0x40,
+    0x40,
+    0x58,
+    0x64,
+    0x44,
+    0x44,
+    0x44,
+    0x64,
+    0x78,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 'c'
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x1C,
+    0x20,
+    0x40,
+    0x40,
+    0x40,
+    0x20,
+    0x1C,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 'd'
+    0x00,
+    0x00,
+    0x04,
+    0x04,
+    0x04,
+    0x3C,
+    0x4C,
+    0x44,
+    0x44,
+    0x44,
+    0x4C,
+    0x34,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 'e'
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x38,
+    0x64,
+    0x44,
+    0x7E,
+    0x40,
+    0x64,
+    0x38,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 'f'
+    0x00,
+    0x00,
+    0x0C,
+    0x10,
+    0x10,
+    0x7C,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 'g'
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x3C,
+    0x4C,
+    0x44,
+    0x44,
+    0x44,
+    0x4C,
+    0x34,
+    0x04,
+    0x0C,
+    0x38,
+    0x00,
+    // 'h'
+    0x00,
+    0x00,
+    0x40,
+    0x40,
+    0x40,
+    0x58,
+    0x64,
+    0x44,
+    0x44,
+    0x44,
+    0x44,
+    0x44,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 'i'
+    0x00,
+    0x00,
+    0x10,
+    0x00,
+    0x00,
+    0x70,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x7C,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 'j'
+    0x00,
+    0x00,
+    0x08,
+    0x00,
+    0x00,
+    0x38,
+    0x08,
+    0x08,
+    0x08,
+    0x08,
+    0x08,
+    0x08,
+    0x18,
+    0x10,
+    0x70,
+    0x00,
+    // 'k'
+    0x00,
+    0x00,
+    0x60,
+    0x60,
+    0x60,
+    0x64,
+    0x68,
+    0x70,
+    0x78,
+    0x68,
+    0x64,
+    0x66,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 'l'
+    0x00,
+    0x00,
+    0x70,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x1C,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 'm'
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x7C,
+    0x52,
+    0x52,
+    0x52,
+    0x52,
+    0x52,
+    0x52,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 'n'
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x58,
+    0x64,
+    0x44,
+    0x44,
+    0x44,
+    0x44,
+    0x44,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 'o'
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x38,
+    0x64,
+    0x44,
+    0x44,
+    0x44,
+    0x64,
+    0x38,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 'p'
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x78,
+    0x64,
+    0x44,
+    0x44,
+    0x44,
+    0x64,
+    0x78,
+    0x40,
+    0x40,
+    0x40,
+    0x00,
+    // 'q'
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x3C,
+    0x6C,
+    0x44,
+    0x44,
+    0x44,
+    0x6C,
+    0x3C,
+    0x04,
+    0x04,
+    0x04,
+    0x00,
+    // 'r'
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x3E,
+    0x30,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 's'
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x38,
+    0x64,
+    0x60,
+    0x38,
+    0x04,
+    0x44,
+    0x38,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 't'
+    0x00,
+    0x00,
+    0x00,
+    0x10,
+    0x10,
+    0x7C,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x1C,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 'u'
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x44,
+    0x44,
+    0x44,
+    0x44,
+    0x44,
+    0x64,
+    0x34,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 'v'
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x44,
+    0x44,
+    0x64,
+    0x28,
+    0x28,
+    0x38,
+    0x10,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 'w'
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x82,
+    0x82,
+    0x52,
+    0x54,
+    0x6C,
+    0x6C,
+    0x64,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 'x'
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x44,
+    0x28,
+    0x38,
+    0x10,
+    0x38,
+    0x24,
+    0x44,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // 'y'
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x46,
+    0x44,
+    0x64,
+    0x2C,
+    0x28,
+    0x18,
+    0x10,
+    0x10,
+    0x10,
+    0x60,
+    0x00,
+    // 'z'
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x7C,
+    0x04,
+    0x08,
+    0x10,
+    0x20,
+    0x20,
+    0x7C,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // '{'
+    0x00,
+    0x00,
+    0x0C,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x70,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x0C,
+    0x00,
+    0x00,
+    0x00,
+    // '|'
+    0x00,
+    0x00,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x00,
+    0x00,
+    // '}'
+    0x00,
+    0x00,
+    0x70,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x0C,
+    0x10,
+    0x10,
+    0x10,
+    0x10,
+    0x70,
+    0x00,
+    0x00,
+    0x00,
+    // '~'
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x70,
+    0x0C,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+};
+
+static const ILI9341_font_t font_mono_12 = {
+    .glyphs = font_mono_12_glyphs,
+    .first = 0x20,
+    .last = 0x7E,
+    .width = 7,
+    .height = 16,
+    .bpp = 1,
+    .row_bytes = 1,
+    .glyph_bytes = 16
+};
+
+#endif
@@ -0,0 +1,2018 @@
+// Generated by tools/font_convert.py from DejaVuSansMono.ttf, size 16, 4 bpp, don't edit
+// 10x20 cell, chars 0x20-0x7E, 9500 bytes
+#pragma once
+#ifndef BAD_FONT_FONT_MONO_16_H
+#define BAD_FONT_FONT_MONO_16_H
+
+#include "ili9341_text.h"
+
+static const uint8_t font_mono_16_glyphs[9500] = {
+    // ' '
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // '!'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0xF9,0x00,0x00,
+    0x00,0x00,0xF9,0x00,0x00,
+    0x00,0x00,0xF9,0x00,0x00,
+    0x00,0x00,0xF9,0x00,0x00,
+    0x00,0x00,0xF9,0x00,0x00,
+    0x00,0x00,0xE9,0x00,0x00,
+    0x00,0x00,0xD8,0x00,0x00,
+    0x00,0x00,0xC7,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0xF9,0x00,0x00,
+    0x00,0x00,0xF9,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // '"'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x5F,0x05,0xF0,0x00,
+    0x00,0x5F,0x05,0xF0,0x00,
+    0x00,0x5F,0x05,0xF0,0x00,
+    0x00,0x5F,0x05,0xF0,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // '#'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x01,0xF3,0x0D,0x60,
+    0x00,0x05,0xE0,0x2F,0x20,
+    0x00,0x09,0xA0,0x6D,0x00,
+    0x1F,0xFF,0xFF,0xFF,0xF9,
+    0x00,0x2F,0x20,0xE4,0x00,
+    0x00,0x5E,0x02,0xF1,0x00,
+    0x00,0x8B,0x06,0xD0,0x00,
+    0xFF,0xFF,0xFF,0xFF,0xB0,
+    0x02,0xF2,0x0E,0x50,0x00,
+    0x06,0xD0,0x3F,0x10,0x00,
+    0x0A,0x90,0x7C,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // '$'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x66,0x00,0x00,
+    0x00,0x00,0x66,0x00,0x00,
+    0x00,0x4B,0xEE,0xA4,0x00,
+    0x03,0xF7,0x67,0x4B,0x00,
+    0x07,0xE0,0x66,0x00,0x00,
+    0x06,0xF3,0x66,0x00,0x00,
+    0x00,0xBF,0xDA,0x40,0x00,
+    0x00,0x04,0xAD,0xFB,0x10,
+    0x00,0x00,0x66,0x2E,0x80,
+    0x00,0x00,0x66,0x0C,0xA0,
+    0x07,0x83,0x67,0x5F,0x50,
+    0x01,0x7C,0xEE,0xC5,0x00,
+    0x00,0x00,0x66,0x00,0x00,
+    0x00,0x00,0x66,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // '%'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x09,0xEC,0x40,0x00,0x00,
+    0x7B,0x14,0xE1,0x00,0x00,
+    0xA5,0x00,0xD3,0x00,0x00,
+    0x7B,0x14,0xE1,0x00,0x30,
+    0x09,0xED,0x40,0x4B,0xA0,
+    0x00,0x00,0x5C,0x92,0x00,
+    0x00,0x5C,0x92,0x00,0x00,
+    0x2C,0x82,0x08,0xED,0x50,
+    0x01,0x00,0x5C,0x13,0xE2,
+    0x00,0x00,0x87,0x00,0xB5,
+    0x00,0x00,0x5C,0x13,0xE2,
+    0x00,0x00,0x08,0xED,0x50,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // '&'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x3C,0xEF,0xC0,0x00,
+    0x00,0xE9,0x10,0x00,0x00,
+    0x02,0xF4,0x00,0x00,0x00,
+    0x00,0xE9,0x00,0x00,0x00,
+    0x00,0x9F,0x30,0x00,0x00,
+    0x06,0xFD,0xD1,0x00,0x00,
+    0x2F,0x62,0xE9,0x00,0xD5,
+    0x7E,0x00,0x6F,0x50,0xE4,
+    0x8D,0x00,0x0A,0xE4,0xF1,
+    0x5F,0x30,0x01,0xDE,0xA0,
+    0x0C,0xD4,0x13,0xBF,0x70,
+    0x01,0x9E,0xFD,0x78,0xF3,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // '''
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0xD7,0x00,0x00,
+    0x00,0x00,0xD7,0x00,0x00,
+    0x00,0x00,0xD7,0x00,0x00,
+    0x00,0x00,0xD7,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // '('
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x09,0xA0,0x00,
+    0x00,0x00,0x3F,0x20,0x00,
+    0x00,0x00,0xAB,0x00,0x00,
+    0x00,0x01,0xF6,0x00,0x00,
+    0x00,0x05,0xF2,0x00,0x00,
+    0x00,0x08,0xF0,0x00,0x00,
+    0x00,0x09,0xD0,0x00,0x00,
+    0x00,0x0A,0xD0,0x00,0x00,
+    0x00,0x08,0xF0,0x00,0x00,
+    0x00,0x05,0xF2,0x00,0x00,
+    0x00,0x01,0xF6,0x00,0x00,
+    0x00,0x00,0xAB,0x00,0x00,
+    0x00,0x00,0x3F,0x20,0x00,
+    0x00,0x00,0x09,0xA0,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // ')'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x1E,0x40,0x00,0x00,
+    0x00,0x08,0xC0,0x00,0x00,
+    0x00,0x02,0xF4,0x00,0x00,
+    0x00,0x00,0xBA,0x00,0x00,
+    0x00,0x00,0x8E,0x00,0x00,
+    0x00,0x00,0x5F,0x30,0x00,
+    0x00,0x00,0x4F,0x40,0x00,
+    0x00,0x00,0x4F,0x40,0x00,
+    0x00,0x00,0x5F,0x30,0x00,
+    0x00,0x00,0x8E,0x00,0x00,
+    0x00,0x00,0xBA,0x00,0x00,
+    0x00,0x02,0xF4,0x00,0x00,
+    0x00,0x08,0xC0,0x00,0x00,
+    0x00,0x1E,0x40,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // '*'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x94,0x00,0x00,
+    0x00,0x00,0x94,0x00,0x00,
+    0x06,0x92,0x94,0x4B,0x20,
+    0x00,0x4A,0xDC,0x82,0x00,
+    0x00,0x4A,0xDC,0x81,0x00,
+    0x06,0x92,0x94,0x4B,0x20,
+    0x00,0x00,0x94,0x00,0x00,
+    0x00,0x00,0x94,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // '+'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0xD7,0x00,0x00,
+    0x00,0x00,0xD7,0x00,0x00,
+    0x00,0x00,0xD7,0x00,0x00,
+    0x5F,0xFF,0xFF,0xFF,0xE0,
+    0x00,0x00,0xD7,0x00,0x00,
+    0x00,0x00,0xD7,0x00,0x00,
+    0x00,0x00,0xD7,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // ','
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x01,0xFD,0x00,0x00,
+    0x00,0x01,0xFD,0x00,0x00,
+    0x00,0x04,0xF8,0x00,0x00,
+    0x00,0x07,0xF1,0x00,0x00,
+    0x00,0x0B,0x90,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // '-'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x3F,0xFF,0xD0,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // '.'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x03,0xFC,0x00,0x00,
+    0x00,0x03,0xFC,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // '/'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x4F,0x30,
+    0x00,0x00,0x00,0xBB,0x00,
+    0x00,0x00,0x03,0xF4,0x00,
+    0x00,0x00,0x0B,0xC0,0x00,
+    0x00,0x00,0x3F,0x50,0x00,
+    0x00,0x00,0xAD,0x00,0x00,
+    0x00,0x02,0xF5,0x00,0x00,
+    0x00,0x09,0xD0,0x00,0x00,
+    0x00,0x1F,0x60,0x00,0x00,
+    0x00,0x8E,0x10,0x00,0x00,
+    0x01,0xE7,0x00,0x00,0x00,
+    0x07,0xE1,0x00,0x00,0x00,
+    0x1E,0x80,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // '0'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x2B,0xEE,0x80,0x00,
+    0x01,0xDA,0x13,0xE9,0x00,
+    0x07,0xF1,0x00,0x7F,0x10,
+    0x0B,0xC0,0x00,0x3F,0x50,
+    0x0D,0xA0,0x00,0x1F,0x80,
+    0x0E,0xA1,0xD9,0x0F,0x90,
+    0x0E,0xA1,0xE9,0x0F,0x90,
+    0x0D,0xA0,0x00,0x1F,0x80,
+    0x0B,0xC0,0x00,0x3F,0x50,
+    0x07,0xF1,0x00,0x7F,0x10,
+    0x01,0xDA,0x13,0xE9,0x00,
+    0x00,0x2B,0xEE,0x80,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // '1'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x39,0xEF,0x20,0x00,
+    0x01,0xC6,0x7F,0x20,0x00,
+    0x00,0x00,0x7F,0x20,0x00,
+    0x00,0x00,0x7F,0x20,0x00,
+    0x00,0x00,0x7F,0x20,0x00,
+    0x00,0x00,0x7F,0x20,0x00,
+    0x00,0x00,0x7F,0x20,0x00,
+    0x00,0x00,0x7F,0x20,0x00,
+    0x00,0x00,0x7F,0x20,0x00,
+    0x00,0x00,0x7F,0x20,0x00,
+    0x00,0x00,0x7F,0x20,0x00,
+    0x00,0xDF,0xFF,0xFF,0x80,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // '2'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x02,0x9D,0xEC,0x60,0x00,
+    0x0B,0xC4,0x14,0xE9,0x00,
+    0x07,0x10,0x00,0x8F,0x10,
+    0x00,0x00,0x00,0x7F,0x30,
+    0x00,0x00,0x00,0xAF,0x10,
+    0x00,0x00,0x04,0xF9,0x00,
+    0x00,0x00,0x1D,0xD1,0x00,
+    0x00,0x00,0xBE,0x20,0x00,
+    0x00,0x0A,0xE3,0x00,0x00,
+    0x00,0x8F,0x50,0x00,0x00,
+    0x06,0xF6,0x00,0x00,0x00,
+    0x0C,0xFF,0xFF,0xFF,0x40,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // '3'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x01,0x7C,0xED,0x71,0x00,
+    0x07,0x72,0x14,0xEA,0x00,
+    0x00,0x00,0x00,0x8F,0x10,
+    0x00,0x00,0x00,0x7F,0x10,
+    0x00,0x00,0x04,0xEA,0x00,
+    0x00,0x0E,0xFF,0xA0,0x00,
+    0x00,0x00,0x14,0xEA,0x00,
+    0x00,0x00,0x00,0x5F,0x40,
+    0x00,0x00,0x00,0x3F,0x60,
+    0x00,0x00,0x00,0x5F,0x40,
+    0x0B,0x52,0x14,0xDC,0x00,
+    0x03,0xAD,0xED,0x81,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // '4'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x0C,0xF5,0x00,
+    0x00,0x00,0x7E,0xF5,0x00,
+    0x00,0x02,0xE7,0xF5,0x00,
+    0x00,0x0B,0x94,0xF5,0x00,
+    0x00,0x5E,0x14,0xF5,0x00,
+    0x01,0xE7,0x04,0xF5,0x00,
+    0x09,0xD0,0x04,0xF5,0x00,
+    0x2F,0x50,0x04,0xF5,0x00,
+    0x3F,0xFF,0xFF,0xFF,0xD0,
+    0x00,0x00,0x04,0xF5,0x00,
+    0x00,0x00,0x04,0xF5,0x00,
+    0x00,0x00,0x04,0xF5,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // '5'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x06,0xFF,0xFF,0xF8,0x00,
+    0x06,0xF1,0x00,0x00,0x00,
+    0x06,0xF1,0x00,0x00,0x00,
+    0x06,0xF1,0x00,0x00,0x00,
+    0x06,0xFE,0xFD,0x70,0x00,
+    0x05,0x71,0x17,0xF9,0x00,
+    0x00,0x00,0x00,0x9F,0x20,
+    0x00,0x00,0x00,0x5F,0x50,
+    0x00,0x00,0x00,0x5F,0x50,
+    0x00,0x00,0x00,0x8F,0x20,
+    0x0A,0x51,0x16,0xF9,0x00,
+    0x03,0xBE,0xFD,0x70,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // '6'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x18,0xDF,0xB3,0x00,
+    0x00,0xBC,0x30,0x38,0x00,
+    0x05,0xF2,0x00,0x00,0x00,
+    0x0A,0xB0,0x00,0x00,0x00,
+    0x0D,0x98,0xEE,0xB2,0x00,
+    0x0E,0xEA,0x12,0xBD,0x00,
+    0x0E,0xE1,0x00,0x3F,0x60,
+    0x0D,0xC0,0x00,0x0F,0x80,
+    0x0B,0xC0,0x00,0x0F,0x80,
+    0x07,0xE1,0x00,0x3F,0x50,
+    0x01,0xEA,0x12,0xBD,0x00,
+    0x00,0x3B,0xEE,0xB2,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // '7'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x0E,0xFF,0xFF,0xFF,0x60,
+    0x00,0x00,0x00,0x8F,0x20,
+    0x00,0x00,0x00,0xDC,0x00,
+    0x00,0x00,0x04,0xF6,0x00,
+    0x00,0x00,0x09,0xF1,0x00,
+    0x00,0x00,0x1E,0xA0,0x00,
+    0x00,0x00,0x5F,0x40,0x00,
+    0x00,0x00,0xBE,0x00,0x00,
+    0x00,0x02,0xF8,0x00,0x00,
+    0x00,0x07,0xF3,0x00,0x00,
+    0x00,0x0D,0xC0,0x00,0x00,
+    0x00,0x3F,0x70,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // '8'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x5C,0xEE,0xA2,0x00,
+    0x04,0xF8,0x12,0xCD,0x10,
+    0x09,0xE0,0x00,0x5F,0x40,
+    0x09,0xE0,0x00,0x5F,0x40,
+    0x03,0xE7,0x12,0xCB,0x00,
+    0x00,0x4E,0xFF,0xB1,0x00,
+    0x04,0xF7,0x12,0xBC,0x10,
+    0x0C,0xC0,0x00,0x2F,0x60,
+    0x0E,0xA0,0x00,0x0F,0x90,
+    0x0C,0xC0,0x00,0x2F,0x70,
+    0x06,0xF7,0x12,0xBE,0x20,
+    0x00,0x6C,0xEE,0xA2,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // '9'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x6D,0xFD,0x80,0x00,
+    0x05,0xF6,0x14,0xE9,0x00,
+    0x0C,0xC0,0x00,0x7F,0x10,
+    0x0E,0x90,0x00,0x4F,0x50,
+    0x0E,0x90,0x00,0x4F,0x70,
+    0x0C,0xC0,0x00,0x7F,0x80,
+    0x05,0xF6,0x14,0xDF,0x80,
+    0x00,0x6D,0xFD,0x4E,0x70,
+    0x00,0x00,0x00,0x2F,0x40,
+    0x00,0x00,0x00,0x7E,0x00,
+    0x02,0x82,0x16,0xF5,0x00,
+    0x00,0x7D,0xEC,0x50,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // ':'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x03,0xFC,0x00,0x00,
+    0x00,0x03,0xFC,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x03,0xFC,0x00,0x00,
+    0x00,0x03,0xFC,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // ';'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x03,0xFC,0x00,0x00,
+    0x00,0x03,0xFC,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x01,0xFD,0x00,0x00,
+    0x00,0x01,0xFD,0x00,0x00,
+    0x00,0x04,0xF8,0x00,0x00,
+    0x00,0x07,0xF1,0x00,0x00,
+    0x00,0x0B,0x90,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // '<'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x16,0xC0,
+    0x00,0x00,0x39,0xEE,0x90,
+    0x01,0x6C,0xFC,0x61,0x00,
+    0x3E,0xE8,0x30,0x00,0x00,
+    0x3E,0xE8,0x20,0x00,0x00,
+    0x01,0x6C,0xFC,0x61,0x00,
+    0x00,0x00,0x39,0xEE,0x90,
+    0x00,0x00,0x00,0x16,0xC0,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // '='
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x5F,0xFF,0xFF,0xFF,0xE0,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x5F,0xFF,0xFF,0xFF,0xE0,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // '>'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x4A,0x40,0x00,0x00,0x00,
+    0x2C,0xFD,0x71,0x00,0x00,
+    0x00,0x28,0xEF,0xA4,0x00,
+    0x00,0x00,0x05,0xAF,0xC0,
+    0x00,0x00,0x04,0xAF,0xC0,
+    0x00,0x28,0xEF,0xA4,0x00,
+    0x2C,0xFD,0x71,0x00,0x00,
+    0x4A,0x40,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // '?'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x4B,0xEE,0xA2,0x00,
+    0x01,0xA4,0x13,0xDC,0x00,
+    0x00,0x00,0x00,0x8F,0x10,
+    0x00,0x00,0x00,0xBE,0x00,
+    0x00,0x00,0x09,0xF5,0x00,
+    0x00,0x00,0x6F,0x60,0x00,
+    0x00,0x00,0xE9,0x00,0x00,
+    0x00,0x02,0xF6,0x00,0x00,
+    0x00,0x02,0xF5,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x03,0xF6,0x00,0x00,
+    0x00,0x03,0xF6,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // '@'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x18,0xDF,0xD7,0x00,
+    0x01,0xDA,0x30,0x3C,0x90,
+    0x0A,0xA0,0x00,0x02,0xF1,
+    0x3E,0x10,0x5D,0xE8,0xE3,
+    0x7A,0x02,0xF5,0x1A,0xF3,
+    0xA7,0x08,0xA0,0x02,0xF3,
+    0xB6,0x0B,0x70,0x00,0xE3,
+    0xB6,0x0B,0x70,0x00,0xE3,
+    0xA8,0x08,0xA0,0x02,0xF3,
+    0x7B,0x02,0xE5,0x1A,0xF3,
+    0x2F,0x20,0x5D,0xE8,0xE3,
+    0x08,0xC1,0x00,0x00,0x00,
+    0x00,0xAC,0x41,0x00,0x00,
+    0x00,0x05,0xBE,0xFC,0x10,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'A'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x04,0xFE,0x00,0x00,
+    0x00,0x09,0xEF,0x30,0x00,
+    0x00,0x0D,0x9E,0x80,0x00,
+    0x00,0x3F,0x5A,0xC0,0x00,
+    0x00,0x7F,0x16,0xF2,0x00,
+    0x00,0xCC,0x02,0xF6,0x00,
+    0x01,0xF8,0x00,0xEB,0x00,
+    0x06,0xF4,0x00,0xAF,0x10,
+    0x0A,0xFF,0xFF,0xFF,0x50,
+    0x0E,0x90,0x00,0x1E,0x90,
+    0x4F,0x50,0x00,0x0B,0xD0,
+    0x8F,0x10,0x00,0x06,0xF3,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'B'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x0B,0xFF,0xFE,0xB3,0x00,
+    0x0B,0xD0,0x02,0xAE,0x20,
+    0x0B,0xD0,0x00,0x3F,0x60,
+    0x0B,0xD0,0x00,0x3F,0x60,
+    0x0B,0xD0,0x02,0xBE,0x20,
+    0x0B,0xFF,0xFF,0xD4,0x00,
+    0x0B,0xD0,0x02,0x9E,0x30,
+    0x0B,0xD0,0x00,0x0D,0xA0,
+    0x0B,0xD0,0x00,0x0B,0xD0,
+    0x0B,0xD0,0x00,0x0D,0xC0,
+    0x0B,0xD0,0x01,0x8F,0x60,
+    0x0B,0xFF,0xFE,0xC5,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'C'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x06,0xCE,0xD8,0x10,
+    0x00,0x8E,0x51,0x3C,0x60,
+    0x03,0xF6,0x00,0x01,0x40,
+    0x09,0xF1,0x00,0x00,0x00,
+    0x0C,0xC0,0x00,0x00,0x00,
+    0x0D,0xB0,0x00,0x00,0x00,
+    0x0D,0xB0,0x00,0x00,0x00,
+    0x0C,0xC0,0x00,0x00,0x00,
+    0x09,0xF1,0x00,0x00,0x00,
+    0x03,0xF6,0x00,0x01,0x40,
+    0x00,0x9E,0x51,0x3C,0x60,
+    0x00,0x06,0xCF,0xD8,0x10,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'D'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x0E,0xFF,0xEA,0x40,0x00,
+    0x0E,0xA0,0x28,0xF5,0x00,
+    0x0E,0xA0,0x00,0x9E,0x10,
+    0x0E,0xA0,0x00,0x4F,0x50,
+    0x0E,0xA0,0x00,0x1F,0x80,
+    0x0E,0xA0,0x00,0x1F,0x90,
+    0x0E,0xA0,0x00,0x0F,0x90,
+    0x0E,0xA0,0x00,0x1F,0x80,
+    0x0E,0xA0,0x00,0x4F,0x50,
+    0x0E,0xA0,0x00,0x9E,0x10,
+    0x0E,0xA0,0x28,0xF5,0x00,
+    0x0E,0xFF,0xEA,0x40,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'E'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x07,0xFF,0xFF,0xFF,0x70,
+    0x07,0xF2,0x00,0x00,0x00,
+    0x07,0xF2,0x00,0x00,0x00,
+    0x07,0xF2,0x00,0x00,0x00,
+    0x07,0xF2,0x00,0x00,0x00,
+    0x07,0xFF,0xFF,0xFF,0x40,
+    0x07,0xF2,0x00,0x00,0x00,
+    0x07,0xF2,0x00,0x00,0x00,
+    0x07,0xF2,0x00,0x00,0x00,
+    0x07,0xF2,0x00,0x00,0x00,
+    0x07,0xF2,0x00,0x00,0x00,
+    0x07,0xFF,0xFF,0xFF,0x90,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'F'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x03,0xFF,0xFF,0xFF,0xA0,
+    0x03,0xF6,0x00,0x00,0x00,
+    0x03,0xF6,0x00,0x00,0x00,
+    0x03,0xF6,0x00,0x00,0x00,
+    0x03,0xF6,0x00,0x00,0x00,
+    0x03,0xFF,0xFF,0xFF,0x30,
+    0x03,0xF6,0x00,0x00,0x00,
+    0x03,0xF6,0x00,0x00,0x00,
+    0x03,0xF6,0x00,0x00,0x00,
+    0x03,0xF6,0x00,0x00,0x00,
+    0x03,0xF6,0x00,0x00,0x00,
+    0x03,0xF6,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'G'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x18,0xDF,0xC6,0x00,
+    0x00,0xCC,0x30,0x4D,0x40,
+    0x07,0xF2,0x00,0x02,0x30,
+    0x0D,0xB0,0x00,0x00,0x00,
+    0x1F,0x80,0x00,0x00,0x00,
+    0x3F,0x70,0x00,0x00,0x00,
+    0x3F,0x70,0x09,0xFF,0x90,
+    0x1F,0x80,0x00,0x0D,0x90,
+    0x0D,0xB0,0x00,0x0D,0x90,
+    0x08,0xF2,0x00,0x0D,0x90,
+    0x01,0xCC,0x30,0x3E,0x90,
+    0x00,0x18,0xDF,0xD9,0x20,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'H'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x0E,0xA0,0x00,0x0F,0x80,
+    0x0E,0xA0,0x00,0x0F,0x80,
+    0x0E,0xA0,0x00,0x0F,0x80,
+    0x0E,0xA0,0x00,0x0F,0x80,
+    0x0E,0xA0,0x00,0x0F,0x80,
+    0x0E,0xFF,0xFF,0xFF,0x80,
+    0x0E,0xA0,0x00,0x0F,0x80,
+    0x0E,0xA0,0x00,0x0F,0x80,
+    0x0E,0xA0,0x00,0x0F,0x80,
+    0x0E,0xA0,0x00,0x0F,0x80,
+    0x0E,0xA0,0x00,0x0F,0x80,
+    0x0E,0xA0,0x00,0x0F,0x80,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'I'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x06,0xFF,0xFF,0xFF,0x10,
+    0x00,0x00,0xF9,0x00,0x00,
+    0x00,0x00,0xF9,0x00,0x00,
+    0x00,0x00,0xF9,0x00,0x00,
+    0x00,0x00,0xF9,0x00,0x00,
+    0x00,0x00,0xF9,0x00,0x00,
+    0x00,0x00,0xF9,0x00,0x00,
+    0x00,0x00,0xF9,0x00,0x00,
+    0x00,0x00,0xF9,0x00,0x00,
+    0x00,0x00,0xF9,0x00,0x00,
+    0x00,0x00,0xF9,0x00,0x00,
+    0x06,0xFF,0xFF,0xFF,0x10,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'J'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x1F,0xFF,0xF7,0x00,
+    0x00,0x00,0x02,0xF7,0x00,
+    0x00,0x00,0x02,0xF7,0x00,
+    0x00,0x00,0x02,0xF7,0x00,
+    0x00,0x00,0x02,0xF7,0x00,
+    0x00,0x00,0x02,0xF7,0x00,
+    0x00,0x00,0x02,0xF7,0x00,
+    0x00,0x00,0x02,0xF7,0x00,
+    0x00,0x00,0x02,0xF6,0x00,
+    0x24,0x00,0x04,0xF4,0x00,
+    0x2F,0x61,0x2C,0xD0,0x00,
+    0x05,0xBE,0xEB,0x30,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'K'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x0E,0xA0,0x00,0x1C,0xD2,
+    0x0E,0xA0,0x01,0xBE,0x20,
+    0x0E,0xA0,0x0B,0xE3,0x00,
+    0x0E,0xA0,0xAE,0x40,0x00,
+    0x0E,0xA8,0xF4,0x00,0x00,
+    0x0E,0xEF,0xF4,0x00,0x00,
+    0x0E,0xF6,0xCD,0x10,0x00,
+    0x0E,0xA0,0x3F,0x90,0x00,
+    0x0E,0xA0,0x08,0xF4,0x00,
+    0x0E,0xA0,0x01,0xDD,0x10,
+    0x0E,0xA0,0x00,0x4F,0x90,
+    0x0E,0xA0,0x00,0x0A,0xF4,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'L'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x05,0xF4,0x00,0x00,0x00,
+    0x05,0xF4,0x00,0x00,0x00,
+    0x05,0xF4,0x00,0x00,0x00,
+    0x05,0xF4,0x00,0x00,0x00,
+    0x05,0xF4,0x00,0x00,0x00,
+    0x05,0xF4,0x00,0x00,0x00,
+    0x05,0xF4,0x00,0x00,0x00,
+    0x05,0xF4,0x00,0x00,0x00,
+    0x05,0xF4,0x00,0x00,0x00,
+    0x05,0xF4,0x00,0x00,0x00,
+    0x05,0xF4,0x00,0x00,0x00,
+    0x05,0xFF,0xFF,0xFF,0xE0,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'M'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x5F,0xE0,0x00,0x5F,0xE0,
+    0x5F,0xE4,0x00,0xAE,0xE0,
+    0x5F,0xA9,0x00,0xEA,0xE0,
+    0x5F,0x5D,0x04,0xD8,0xE0,
+    0x5F,0x2D,0x39,0x88,0xE0,
+    0x5F,0x29,0x8E,0x38,0xE0,
+    0x5F,0x24,0xFD,0x08,0xE0,
+    0x5F,0x20,0xE8,0x08,0xE0,
+    0x5F,0x20,0x00,0x08,0xE0,
+    0x5F,0x20,0x00,0x08,0xE0,
+    0x5F,0x20,0x00,0x08,0xE0,
+    0x5F,0x20,0x00,0x08,0xE0,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'N'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x0E,0xF4,0x00,0x0F,0x80,
+    0x0E,0xFA,0x00,0x0F,0x80,
+    0x0E,0xDF,0x20,0x0F,0x80,
+    0x0E,0x9D,0x70,0x0F,0x80,
+    0x0E,0x97,0xD0,0x0F,0x80,
+    0x0E,0x91,0xF4,0x0F,0x80,
+    0x0E,0x90,0xAA,0x0F,0x80,
+    0x0E,0x90,0x4F,0x1F,0x80,
+    0x0E,0x90,0x0D,0x7F,0x80,
+    0x0E,0x90,0x07,0xDF,0x80,
+    0x0E,0x90,0x01,0xFF,0x80,
+    0x0E,0x90,0x00,0xAF,0x80,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'O'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x3C,0xEE,0x91,0x00,
+    0x02,0xE9,0x12,0xDB,0x00,
+    0x09,0xE0,0x00,0x5F,0x30,
+    0x0D,0xB0,0x00,0x1F,0x70,
+    0x0F,0x90,0x00,0x0F,0xA0,
+    0x1F,0x90,0x00,0x0E,0xA0,
+    0x1F,0x90,0x00,0x0E,0xA0,
+    0x0F,0x90,0x00,0x0F,0xA0,
+    0x0D,0xB0,0x00,0x1F,0x70,
+    0x09,0xE0,0x00,0x5F,0x30,
+    0x02,0xE9,0x12,0xDB,0x00,
+    0x00,0x3C,0xFE,0x91,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'P'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x07,0xFF,0xFE,0xC5,0x00,
+    0x07,0xF2,0x01,0x9F,0x60,
+    0x07,0xF2,0x00,0x0E,0xC0,
+    0x07,0xF2,0x00,0x0C,0xD0,
+    0x07,0xF2,0x00,0x0E,0xB0,
+    0x07,0xF2,0x01,0x9F,0x50,
+    0x07,0xFF,0xFE,0xC5,0x00,
+    0x07,0xF2,0x00,0x00,0x00,
+    0x07,0xF2,0x00,0x00,0x00,
+    0x07,0xF2,0x00,0x00,0x00,
+    0x07,0xF2,0x00,0x00,0x00,
+    0x07,0xF2,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'Q'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x3C,0xEE,0x91,0x00,
+    0x02,0xE9,0x12,0xDB,0x00,
+    0x09,0xE0,0x00,0x5F,0x30,
+    0x0D,0xB0,0x00,0x1F,0x70,
+    0x0F,0x90,0x00,0x0F,0x90,
+    0x1F,0x90,0x00,0x0E,0xA0,
+    0x1F,0x90,0x00,0x0E,0xA0,
+    0x0F,0x90,0x00,0x0F,0x90,
+    0x0D,0xB0,0x00,0x1F,0x70,
+    0x09,0xE0,0x00,0x5F,0x40,
+    0x02,0xE9,0x12,0xDB,0x00,
+    0x00,0x3C,0xFF,0xD1,0x00,
+    0x00,0x00,0x06,0xF6,0x00,
+    0x00,0x00,0x00,0x89,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'R'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x0D,0xFF,0xFD,0x81,0x00,
+    0x0D,0xB0,0x04,0xEB,0x00,
+    0x0D,0xB0,0x00,0x8F,0x30,
+    0x0D,0xB0,0x00,0x5F,0x50,
+    0x0D,0xB0,0x00,0x7F,0x30,
+    0x0D,0xB0,0x04,0xEA,0x00,
+    0x0D,0xFF,0xFF,0x80,0x00,
+    0x0D,0xB0,0x17,0xF4,0x00,
+    0x0D,0xB0,0x00,0xBD,0x00,
+    0x0D,0xB0,0x00,0x3F,0x60,
+    0x0D,0xB0,0x00,0x0B,0xD0,
+    0x0D,0xB0,0x00,0x04,0xF6,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'S'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x4B,0xEE,0xA3,0x00,
+    0x05,0xF7,0x11,0x9E,0x00,
+    0x0C,0xB0,0x00,0x06,0x00,
+    0x0D,0xA0,0x00,0x00,0x00,
+    0x0A,0xE3,0x00,0x00,0x00,
+    0x02,0xCF,0xC8,0x30,0x00,
+    0x00,0x04,0x8C,0xFA,0x00,
+    0x00,0x00,0x00,0x6F,0x50,
+    0x00,0x00,0x00,0x0F,0x80,
+    0x07,0x00,0x00,0x1F,0x70,
+    0x0C,0xC4,0x02,0xBE,0x20,
+    0x02,0x9D,0xFD,0xA3,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'T'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x9F,0xFF,0xFF,0xFF,0xF4,
+    0x00,0x00,0xF9,0x00,0x00,
+    0x00,0x00,0xF9,0x00,0x00,
+    0x00,0x00,0xF9,0x00,0x00,
+    0x00,0x00,0xF9,0x00,0x00,
+    0x00,0x00,0xF9,0x00,0x00,
+    0x00,0x00,0xF9,0x00,0x00,
+    0x00,0x00,0xF9,0x00,0x00,
+    0x00,0x00,0xF9,0x00,0x00,
+    0x00,0x00,0xF9,0x00,0x00,
+    0x00,0x00,0xF9,0x00,0x00,
+    0x00,0x00,0xF9,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'U'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x0D,0xB0,0x00,0x1F,0x70,
+    0x0D,0xB0,0x00,0x1F,0x70,
+    0x0D,0xB0,0x00,0x1F,0x70,
+    0x0D,0xB0,0x00,0x1F,0x70,
+    0x0D,0xB0,0x00,0x1F,0x70,
+    0x0D,0xB0,0x00,0x1F,0x70,
+    0x0D,0xB0,0x00,0x1F,0x70,
+    0x0D,0xB0,0x00,0x1F,0x70,
+    0x0C,0xB0,0x00,0x1F,0x70,
+    0x0A,0xC0,0x00,0x3F,0x50,
+    0x05,0xF7,0x12,0xBE,0x10,
+    0x00,0x5C,0xEE,0xA2,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'V'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x6F,0x30,0x00,0x09,0xF1,
+    0x2F,0x70,0x00,0x0C,0xB0,
+    0x0D,0xB0,0x00,0x1F,0x70,
+    0x08,0xE0,0x00,0x5F,0x30,
+    0x04,0xF3,0x00,0x9E,0x00,
+    0x00,0xE7,0x00,0xD9,0x00,
+    0x00,0xBB,0x02,0xF5,0x00,
+    0x00,0x6F,0x06,0xF1,0x00,
+    0x00,0x2F,0x4A,0xC0,0x00,
+    0x00,0x0D,0x8D,0x70,0x00,
+    0x00,0x09,0xDF,0x30,0x00,
+    0x00,0x04,0xFE,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'W'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0xE9,0x00,0x00,0x00,0xE8,
+    0xCB,0x00,0x00,0x01,0xF6,
+    0xAD,0x00,0x00,0x03,0xF4,
+    0x7E,0x02,0xFB,0x05,0xF2,
+    0x5F,0x15,0xFE,0x06,0xF0,
+    0x3F,0x38,0xAF,0x28,0xD0,
+    0x1F,0x4B,0x6C,0x5A,0xA0,
+    0x0E,0x6E,0x39,0x8C,0x80,
+    0x0B,0x9E,0x05,0xBD,0x60,
+    0x09,0xEC,0x02,0xEF,0x40,
+    0x07,0xF8,0x00,0xEF,0x20,
+    0x05,0xF5,0x00,0xBE,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'X'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x1E,0xA0,0x00,0x0B,0xD1,
+    0x06,0xF3,0x00,0x5F,0x50,
+    0x00,0xCC,0x00,0xDA,0x00,
+    0x00,0x4F,0x57,0xE2,0x00,
+    0x00,0x0A,0xDE,0x70,0x00,
+    0x00,0x02,0xFD,0x00,0x00,
+    0x00,0x07,0xFF,0x40,0x00,
+    0x00,0x2E,0x8A,0xC0,0x00,
+    0x00,0xBD,0x12,0xF6,0x00,
+    0x05,0xF5,0x00,0x9E,0x10,
+    0x1D,0xB0,0x00,0x1E,0x90,
+    0x8F,0x20,0x00,0x07,0xF3,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'Y'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x6F,0x40,0x00,0x09,0xE2,
+    0x0D,0xC0,0x00,0x2F,0x70,
+    0x04,0xF5,0x00,0xAD,0x10,
+    0x00,0xBD,0x03,0xF5,0x00,
+    0x00,0x3F,0x6B,0xC0,0x00,
+    0x00,0x09,0xEF,0x40,0x00,
+    0x00,0x01,0xFB,0x00,0x00,
+    0x00,0x00,0xF9,0x00,0x00,
+    0x00,0x00,0xF9,0x00,0x00,
+    0x00,0x00,0xF9,0x00,0x00,
+    0x00,0x00,0xF9,0x00,0x00,
+    0x00,0x00,0xF9,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'Z'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x09,0xFF,0xFF,0xFF,0xF0,
+    0x00,0x00,0x00,0x3F,0xC0,
+    0x00,0x00,0x00,0xBF,0x30,
+    0x00,0x00,0x06,0xF9,0x00,
+    0x00,0x00,0x1E,0xD1,0x00,
+    0x00,0x00,0x9F,0x50,0x00,
+    0x00,0x03,0xFA,0x00,0x00,
+    0x00,0x0C,0xE2,0x00,0x00,
+    0x00,0x6F,0x70,0x00,0x00,
+    0x01,0xEC,0x00,0x00,0x00,
+    0x09,0xF3,0x00,0x00,0x00,
+    0x0C,0xFF,0xFF,0xFF,0xF2,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // '['
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x06,0xFF,0xE0,0x00,
+    0x00,0x06,0xF1,0x00,0x00,
+    0x00,0x06,0xF1,0x00,0x00,
+    0x00,0x06,0xF1,0x00,0x00,
+    0x00,0x06,0xF1,0x00,0x00,
+    0x00,0x06,0xF1,0x00,0x00,
+    0x00,0x06,0xF1,0x00,0x00,
+    0x00,0x06,0xF1,0x00,0x00,
+    0x00,0x06,0xF1,0x00,0x00,
+    0x00,0x06,0xF1,0x00,0x00,
+    0x00,0x06,0xF1,0x00,0x00,
+    0x00,0x06,0xF1,0x00,0x00,
+    0x00,0x06,0xF1,0x00,0x00,
+    0x00,0x06,0xFF,0xE0,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'backslash'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x1E,0x80,0x00,0x00,0x00,
+    0x07,0xE1,0x00,0x00,0x00,
+    0x01,0xE7,0x00,0x00,0x00,
+    0x00,0x8E,0x10,0x00,0x00,
+    0x00,0x2F,0x60,0x00,0x00,
+    0x00,0x09,0xD0,0x00,0x00,
+    0x00,0x02,0xF5,0x00,0x00,
+    0x00,0x00,0xAD,0x00,0x00,
+    0x00,0x00,0x3F,0x50,0x00,
+    0x00,0x00,0x0B,0xC0,0x00,
+    0x00,0x00,0x03,0xF4,0x00,
+    0x00,0x00,0x00,0xBB,0x00,
+    0x00,0x00,0x00,0x4F,0x30,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // ']'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x4F,0xFF,0x00,0x00,
+    0x00,0x00,0x6F,0x00,0x00,
+    0x00,0x00,0x6F,0x00,0x00,
+    0x00,0x00,0x6F,0x00,0x00,
+    0x00,0x00,0x6F,0x00,0x00,
+    0x00,0x00,0x6F,0x00,0x00,
+    0x00,0x00,0x6F,0x00,0x00,
+    0x00,0x00,0x6F,0x00,0x00,
+    0x00,0x00,0x6F,0x00,0x00,
+    0x00,0x00,0x6F,0x00,0x00,
+    0x00,0x00,0x6F,0x00,0x00,
+    0x00,0x00,0x6F,0x00,0x00,
+    0x00,0x00,0x6F,0x00,0x00,
+    0x00,0x4F,0xFF,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // '^'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x05,0xFD,0x10,0x00,
+    0x00,0x4F,0x8C,0xC1,0x00,
+    0x03,0xE7,0x01,0xCB,0x00,
+    0x2D,0x70,0x00,0x1C,0x90,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // '_'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0xFF,0xFF,0xFF,0xFF,0xFA,
+    0x00,0x00,0x00,0x00,0x00,
+    // '`'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x6E,0x20,0x00,0x00,
+    0x00,0x08,0xC0,0x00,0x00,
+    0x00,0x00,0xA8,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'a'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x6C,0xEE,0xA2,0x00,
+    0x04,0x93,0x02,0xBD,0x00,
+    0x00,0x00,0x00,0x3F,0x30,
+    0x00,0x6C,0xEF,0xFF,0x40,
+    0x07,0xE5,0x10,0x3F,0x40,
+    0x0D,0x90,0x00,0x5F,0x40,
+    0x0D,0x80,0x00,0x9F,0x40,
+    0x09,0xE3,0x16,0xEF,0x40,
+    0x01,0x9E,0xEB,0x5F,0x40,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'b'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x07,0xE0,0x00,0x00,0x00,
+    0x07,0xE0,0x00,0x00,0x00,
+    0x07,0xE0,0x00,0x00,0x00,
+    0x07,0xE5,0xDF,0xB3,0x00,
+    0x07,0xFC,0x22,0xBD,0x00,
+    0x07,0xF4,0x00,0x2F,0x60,
+    0x07,0xF1,0x00,0x0E,0x90,
+    0x07,0xF0,0x00,0x0D,0xA0,
+    0x07,0xF1,0x00,0x0E,0x80,
+    0x07,0xF4,0x00,0x2F,0x60,
+    0x07,0xFC,0x22,0xBD,0x00,
+    0x07,0xE6,0xDF,0xB3,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'c'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x06,0xCF,0xD8,0x00,
+    0x00,0x8E,0x61,0x26,0x40,
+    0x02,0xF7,0x00,0x00,0x00,
+    0x06,0xF2,0x00,0x00,0x00,
+    0x07,0xF1,0x00,0x00,0x00,
+    0x06,0xF3,0x00,0x00,0x00,
+    0x02,0xF7,0x00,0x00,0x00,
+    0x00,0x8E,0x61,0x26,0x40,
+    0x00,0x06,0xCF,0xD8,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'd'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x4F,0x20,
+    0x00,0x00,0x00,0x4F,0x20,
+    0x00,0x00,0x00,0x4F,0x20,
+    0x00,0x6D,0xFC,0x7F,0x20,
+    0x04,0xF7,0x15,0xEF,0x20,
+    0x0B,0xC0,0x00,0x9F,0x20,
+    0x0E,0x90,0x00,0x6F,0x20,
+    0x0F,0x80,0x00,0x5F,0x20,
+    0x0E,0x90,0x00,0x6F,0x20,
+    0x0B,0xC0,0x00,0x9F,0x20,
+    0x04,0xF6,0x15,0xEF,0x20,
+    0x00,0x6D,0xFC,0x7F,0x20,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'e'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x2A,0xEE,0xB2,0x00,
+    0x02,0xEA,0x21,0xAD,0x00,
+    0x0A,0xD0,0x00,0x1E,0x60,
+    0x0E,0x90,0x00,0x0C,0x90,
+    0x0F,0xFF,0xFF,0xFF,0xA0,
+    0x0E,0x80,0x00,0x00,0x00,
+    0x0A,0xC0,0x00,0x00,0x00,
+    0x02,0xE9,0x21,0x39,0x50,
+    0x00,0x3A,0xEE,0xC6,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'f'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x5D,0xFF,0x50,
+    0x00,0x00,0xE8,0x00,0x00,
+    0x00,0x02,0xF5,0x00,0x00,
+    0x07,0xFF,0xFF,0xFF,0x50,
+    0x00,0x02,0xF4,0x00,0x00,
+    0x00,0x02,0xF4,0x00,0x00,
+    0x00,0x02,0xF4,0x00,0x00,
+    0x00,0x02,0xF4,0x00,0x00,
+    0x00,0x02,0xF4,0x00,0x00,
+    0x00,0x02,0xF4,0x00,0x00,
+    0x00,0x02,0xF4,0x00,0x00,
+    0x00,0x02,0xF4,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'g'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x5D,0xFC,0x7F,0x20,
+    0x04,0xF7,0x15,0xEF,0x20,
+    0x0B,0xC0,0x00,0x9F,0x20,
+    0x0E,0x90,0x00,0x6F,0x20,
+    0x0F,0x80,0x00,0x5F,0x20,
+    0x0E,0x90,0x00,0x6F,0x20,
+    0x0B,0xC0,0x00,0x9F,0x20,
+    0x04,0xF7,0x14,0xEF,0x20,
+    0x00,0x6D,0xFC,0x7F,0x20,
+    0x00,0x00,0x00,0x6F,0x00,
+    0x01,0xA3,0x13,0xD9,0x00,
+    0x00,0x5C,0xED,0x81,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'h'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x07,0xF0,0x00,0x00,0x00,
+    0x07,0xF0,0x00,0x00,0x00,
+    0x07,0xF0,0x00,0x00,0x00,
+    0x07,0xF4,0xCF,0xC3,0x00,
+    0x07,0xFB,0x21,0xCD,0x00,
+    0x07,0xF3,0x00,0x5F,0x20,
+    0x07,0xF0,0x00,0x4F,0x30,
+    0x07,0xF0,0x00,0x4F,0x30,
+    0x07,0xF0,0x00,0x4F,0x30,
+    0x07,0xF0,0x00,0x4F,0x30,
+    0x07,0xF0,0x00,0x4F,0x30,
+    0x07,0xF0,0x00,0x4F,0x30,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'i'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0xBA,0x00,0x00,
+    0x00,0x00,0xBA,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0xFF,0xFA,0x00,0x00,
+    0x00,0x00,0xBA,0x00,0x00,
+    0x00,0x00,0xBA,0x00,0x00,
+    0x00,0x00,0xBA,0x00,0x00,
+    0x00,0x00,0xBA,0x00,0x00,
+    0x00,0x00,0xBA,0x00,0x00,
+    0x00,0x00,0xBA,0x00,0x00,
+    0x00,0x00,0xBA,0x00,0x00,
+    0x09,0xFF,0xFF,0xFF,0x80,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'j'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x5F,0x20,0x00,
+    0x00,0x00,0x5F,0x20,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0xCF,0xFF,0x20,0x00,
+    0x00,0x00,0x5F,0x20,0x00,
+    0x00,0x00,0x5F,0x20,0x00,
+    0x00,0x00,0x5F,0x20,0x00,
+    0x00,0x00,0x5F,0x20,0x00,
+    0x00,0x00,0x5F,0x20,0x00,
+    0x00,0x00,0x5F,0x20,0x00,
+    0x00,0x00,0x5F,0x20,0x00,
+    0x00,0x00,0x5F,0x20,0x00,
+    0x00,0x00,0x6F,0x10,0x00,
+    0x00,0x01,0xBC,0x00,0x00,
+    0x08,0xFF,0xC3,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'k'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x02,0xF5,0x00,0x00,0x00,
+    0x02,0xF5,0x00,0x00,0x00,
+    0x02,0xF5,0x00,0x00,0x00,
+    0x02,0xF5,0x00,0x6F,0x50,
+    0x02,0xF5,0x06,0xF5,0x00,
+    0x02,0xF5,0x6F,0x50,0x00,
+    0x02,0xFB,0xF9,0x00,0x00,
+    0x02,0xFF,0xAF,0x30,0x00,
+    0x02,0xF6,0x0C,0xD1,0x00,
+    0x02,0xF5,0x02,0xE9,0x00,
+    0x02,0xF5,0x00,0x6F,0x50,
+    0x02,0xF5,0x00,0x0B,0xE2,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'l'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x0B,0xFF,0xF0,0x00,0x00,
+    0x00,0x07,0xF0,0x00,0x00,
+    0x00,0x07,0xF0,0x00,0x00,
+    0x00,0x07,0xF0,0x00,0x00,
+    0x00,0x07,0xF0,0x00,0x00,
+    0x00,0x07,0xF0,0x00,0x00,
+    0x00,0x07,0xF0,0x00,0x00,
+    0x00,0x07,0xF0,0x00,0x00,
+    0x00,0x07,0xF0,0x00,0x00,
+    0x00,0x06,0xF1,0x00,0x00,
+    0x00,0x02,0xF7,0x00,0x00,
+    0x00,0x00,0x6D,0xFF,0x10,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'm'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x2F,0xAE,0xC6,0xED,0x30,
+    0x2F,0x72,0xFC,0x1A,0xA0,
+    0x2F,0x30,0xD8,0x07,0xC0,
+    0x2F,0x20,0xC8,0x07,0xD0,
+    0x2F,0x20,0xC8,0x07,0xD0,
+    0x2F,0x20,0xC8,0x07,0xD0,
+    0x2F,0x20,0xC8,0x07,0xD0,
+    0x2F,0x20,0xC8,0x07,0xD0,
+    0x2F,0x20,0xC8,0x07,0xD0,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'n'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x07,0xF4,0xCF,0xC3,0x00,
+    0x07,0xFB,0x21,0xCD,0x00,
+    0x07,0xF3,0x00,0x5F,0x20,
+    0x07,0xF0,0x00,0x4F,0x30,
+    0x07,0xF0,0x00,0x4F,0x30,
+    0x07,0xF0,0x00,0x4F,0x30,
+    0x07,0xF0,0x00,0x4F,0x30,
+    0x07,0xF0,0x00,0x4F,0x30,
+    0x07,0xF0,0x00,0x4F,0x30,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'o'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x4C,0xFE,0xA1,0x00,
+    0x03,0xF9,0x13,0xDC,0x00,
+    0x0A,0xE0,0x00,0x4F,0x40,
+    0x0D,0xA0,0x00,0x1F,0x70,
+    0x0E,0x90,0x00,0x0F,0x80,
+    0x0D,0xA0,0x00,0x1F,0x70,
+    0x0A,0xE0,0x00,0x4F,0x40,
+    0x03,0xF9,0x13,0xDC,0x00,
+    0x00,0x4C,0xFE,0xA1,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'p'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x08,0xE6,0xDF,0xB2,0x00,
+    0x08,0xFC,0x22,0xBD,0x00,
+    0x08,0xF4,0x00,0x2F,0x50,
+    0x08,0xF0,0x00,0x0E,0x80,
+    0x08,0xE0,0x00,0x0D,0x90,
+    0x08,0xF0,0x00,0x0E,0x80,
+    0x08,0xF4,0x00,0x2F,0x50,
+    0x08,0xFC,0x22,0xBD,0x00,
+    0x08,0xE7,0xDF,0xB2,0x00,
+    0x08,0xE0,0x00,0x00,0x00,
+    0x08,0xE0,0x00,0x00,0x00,
+    0x08,0xE0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'q'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x5D,0xFC,0x7F,0x40,
+    0x02,0xF8,0x14,0xEF,0x40,
+    0x09,0xD0,0x00,0x8F,0x40,
+    0x0C,0xA0,0x00,0x4F,0x40,
+    0x0D,0x90,0x00,0x3F,0x40,
+    0x0C,0xA0,0x00,0x4F,0x40,
+    0x09,0xD0,0x00,0x8F,0x40,
+    0x03,0xF8,0x14,0xEF,0x40,
+    0x00,0x5D,0xFC,0x7F,0x40,
+    0x00,0x00,0x00,0x3F,0x40,
+    0x00,0x00,0x00,0x3F,0x40,
+    0x00,0x00,0x00,0x3F,0x40,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'r'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x3F,0x48,0xEE,0x70,
+    0x00,0x3F,0xC8,0x22,0x80,
+    0x00,0x3F,0xB0,0x00,0x00,
+    0x00,0x3F,0x60,0x00,0x00,
+    0x00,0x3F,0x50,0x00,0x00,
+    0x00,0x3F,0x40,0x00,0x00,
+    0x00,0x3F,0x40,0x00,0x00,
+    0x00,0x3F,0x40,0x00,0x00,
+    0x00,0x3F,0x40,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 's'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x3B,0xEE,0x92,0x00,
+    0x01,0xE9,0x11,0x57,0x00,
+    0x04,0xF3,0x00,0x00,0x00,
+    0x02,0xFB,0x41,0x00,0x00,
+    0x00,0x4C,0xFF,0xC3,0x00,
+    0x00,0x00,0x15,0xDD,0x00,
+    0x00,0x00,0x00,0x7F,0x00,
+    0x05,0x93,0x12,0xCB,0x00,
+    0x00,0x6C,0xED,0x91,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 't'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x0A,0xC0,0x00,0x00,
+    0x00,0x0A,0xC0,0x00,0x00,
+    0x0F,0xFF,0xFF,0xFF,0x10,
+    0x00,0x0A,0xC0,0x00,0x00,
+    0x00,0x0A,0xC0,0x00,0x00,
+    0x00,0x0A,0xC0,0x00,0x00,
+    0x00,0x0A,0xC0,0x00,0x00,
+    0x00,0x0A,0xC0,0x00,0x00,
+    0x00,0x09,0xD0,0x00,0x00,
+    0x00,0x06,0xF4,0x00,0x00,
+    0x00,0x00,0x9E,0xFF,0x10,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'u'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x07,0xF0,0x00,0x4F,0x30,
+    0x07,0xF0,0x00,0x4F,0x30,
+    0x07,0xF0,0x00,0x4F,0x30,
+    0x07,0xF0,0x00,0x4F,0x30,
+    0x07,0xF0,0x00,0x4F,0x30,
+    0x07,0xF0,0x00,0x4F,0x30,
+    0x06,0xF1,0x00,0x7F,0x30,
+    0x02,0xF8,0x13,0xDF,0x30,
+    0x00,0x6D,0xFB,0x6F,0x30,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'v'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x1F,0x70,0x00,0x0C,0xA0,
+    0x0B,0xC0,0x00,0x2F,0x50,
+    0x05,0xF2,0x00,0x7E,0x10,
+    0x01,0xE7,0x00,0xCA,0x00,
+    0x00,0xAC,0x02,0xF5,0x00,
+    0x00,0x5F,0x27,0xE0,0x00,
+    0x00,0x0E,0x7D,0x90,0x00,
+    0x00,0x09,0xEF,0x40,0x00,
+    0x00,0x04,0xFE,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'w'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0xD8,0x00,0x00,0x00,0xD8,
+    0xAB,0x00,0x00,0x01,0xF4,
+    0x7E,0x00,0x00,0x05,0xF1,
+    0x3F,0x20,0xE8,0x08,0xD0,
+    0x0E,0x53,0xDD,0x0B,0x90,
+    0x0B,0x88,0x7D,0x2E,0x60,
+    0x08,0xCC,0x38,0x9F,0x20,
+    0x04,0xFD,0x04,0xFE,0x00,
+    0x01,0xF9,0x00,0xEB,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'x'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x0B,0xC0,0x00,0x4F,0x60,
+    0x01,0xE9,0x01,0xDA,0x00,
+    0x00,0x4F,0x4A,0xD1,0x00,
+    0x00,0x08,0xEF,0x30,0x00,
+    0x00,0x03,0xFC,0x00,0x00,
+    0x00,0x0C,0xCE,0x70,0x00,
+    0x00,0x9E,0x26,0xF3,0x00,
+    0x05,0xF5,0x00,0xAD,0x10,
+    0x2E,0x90,0x00,0x1E,0xA0,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'y'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x1E,0x80,0x00,0x0B,0xC0,
+    0x09,0xD0,0x00,0x1F,0x70,
+    0x03,0xF4,0x00,0x6F,0x10,
+    0x00,0xC9,0x00,0xCA,0x00,
+    0x00,0x7E,0x12,0xF4,0x00,
+    0x00,0x1F,0x68,0xD0,0x00,
+    0x00,0x0A,0xBD,0x80,0x00,
+    0x00,0x04,0xFF,0x20,0x00,
+    0x00,0x00,0xEB,0x00,0x00,
+    0x00,0x02,0xF5,0x00,0x00,
+    0x00,0x1A,0xD0,0x00,0x00,
+    0x08,0xFC,0x30,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // 'z'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x03,0xFF,0xFF,0xFF,0x20,
+    0x00,0x00,0x00,0xBE,0x10,
+    0x00,0x00,0x08,0xF4,0x00,
+    0x00,0x00,0x4F,0x80,0x00,
+    0x00,0x02,0xEB,0x00,0x00,
+    0x00,0x0C,0xE1,0x00,0x00,
+    0x00,0x9F,0x40,0x00,0x00,
+    0x04,0xF7,0x00,0x00,0x00,
+    0x06,0xFF,0xFF,0xFF,0x20,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // '{'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x3B,0xEE,0x00,
+    0x00,0x00,0xAD,0x20,0x00,
+    0x00,0x00,0xDA,0x00,0x00,
+    0x00,0x00,0xD9,0x00,0x00,
+    0x00,0x00,0xD9,0x00,0x00,
+    0x00,0x00,0xE8,0x00,0x00,
+    0x00,0x16,0xF5,0x00,0x00,
+    0x04,0xFF,0x90,0x00,0x00,
+    0x00,0x16,0xF5,0x00,0x00,
+    0x00,0x00,0xE8,0x00,0x00,
+    0x00,0x00,0xD9,0x00,0x00,
+    0x00,0x00,0xD9,0x00,0x00,
+    0x00,0x00,0xDA,0x00,0x00,
+    0x00,0x00,0xAD,0x20,0x00,
+    0x00,0x00,0x3B,0xEE,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // '|'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0xD7,0x00,0x00,
+    0x00,0x00,0xD7,0x00,0x00,
+    0x00,0x00,0xD7,0x00,0x00,
+    0x00,0x00,0xD7,0x00,0x00,
+    0x00,0x00,0xD7,0x00,0x00,
+    0x00,0x00,0xD7,0x00,0x00,
+    0x00,0x00,0xD7,0x00,0x00,
+    0x00,0x00,0xD7,0x00,0x00,
+    0x00,0x00,0xD7,0x00,0x00,
+    0x00,0x00,0xD7,0x00,0x00,
+    0x00,0x00,0xD7,0x00,0x00,
+    0x00,0x00,0xD7,0x00,0x00,
+    0x00,0x00,0xD7,0x00,0x00,
+    0x00,0x00,0xD7,0x00,0x00,
+    0x00,0x00,0xD7,0x00,0x00,
+    0x00,0x00,0xD7,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // '}'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x04,0xFE,0x90,0x00,0x00,
+    0x00,0x05,0xF4,0x00,0x00,
+    0x00,0x00,0xF7,0x00,0x00,
+    0x00,0x00,0xF7,0x00,0x00,
+    0x00,0x00,0xF7,0x00,0x00,
+    0x00,0x00,0xE8,0x00,0x00,
+    0x00,0x00,0xAD,0x30,0x00,
+    0x00,0x00,0x2D,0xFE,0x00,
+    0x00,0x00,0xAD,0x20,0x00,
+    0x00,0x00,0xE8,0x00,0x00,
+    0x00,0x00,0xF7,0x00,0x00,
+    0x00,0x00,0xF7,0x00,0x00,
+    0x00,0x00,0xF7,0x00,0x00,
+    0x00,0x05,0xF4,0x00,0x00,
+    0x04,0xFE,0x90,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    // '~'
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x19,0xDE,0xA5,0x13,0xA0,
+    0x47,0x21,0x6B,0xEC,0x50,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,
+};
+
+static const ILI9341_font_t font_mono_16 = {
+    .glyphs = font_mono_16_glyphs,
+    .first = 0x20,
+    .last = 0x7E,
+    .width = 10,
+    .height = 20,
+    .bpp = 4,
+    .row_bytes = 5,
+    .glyph_bytes = 100
+};
+
+#endif
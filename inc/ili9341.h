@@ -8,6 +8,8 @@
  *    all driver functions.
  *  - Optionally define `BAD_ILI9341_STATIC` to make all functions `static inline`.
  *  - Optionally define `BAD_ILI9341_INCLUDE_ISRS` to enable DMA transfer complete ISR support.
+ *  - Optionally define `BAD_ILI9341_USE_TE` for tear free frames paced by the
+ *    panel's TE output (ILI9341_TE_PIN) through the EXTI dispatch table.
  *
  * Example:
  *  #define BAD_ILI9341_IMPLEMENTATION
@@ -28,6 +30,55 @@
  *
  *  // Poll until DMA transfer is complete
  *  while (!ili9341_poll_dma_ready());
+ *
+ *  // or sleep until it is, needs BAD_PWR_IMPLEMENTATION somewhere
+ *  ili9341_wait_dma_ready();
+ *
+ *  // Landscape, coordinates and the size asserts follow the rotation
+ *  ili9341_set_rotation(ILI9341_ROTATION_90); // ili9341_width() == 320
+ *
+ *  // Log view: 16 fixed header rows, the other 304 scroll in hardware
+ *  ili9341_set_rotation(ILI9341_ROTATION_0);
+ *  ili9341_scroll_setup(16, 0);
+ *  uint16_t y = ili9341_scroll_line(16);   // one register write
+ *  ili9341_fb_dma_fill(line, 0, y, 239, y + 15); // new line at the bottom
+ *
+ * Scrolling notes:
+ *  - The controller scrolls along the 320 panel rows: y in ILI9341_ROTATION_0,
+ *    x in ILI9341_ROTATION_90 (a plot growing to the right). 180 and 270 run
+ *    the other way, only ili9341_scroll_to makes sense there.
+ *  - Line heights should divide the scroll area, a line never wraps then.
+ *  - Rotation, scroll and fill commands go over the command SPI mode, wait
+ *    for the last DMA fill first.
+ *
+ * Tear free frames (BAD_ILI9341_USE_TE):
+ *  ili9341_set_frame_rate(ILI9341_FRAME_RATE_70HZ);
+ *  ili9341_te_setup(2);                    // a frame every 2nd vblank, 35 FPS
+ *  while (1) {
+ *      draw(fb[i]);
+ *      ili9341_te_present(fb[i], 0, 0, 239, 79); // DMA starts on the next due TE edge
+ *      i ^= 1;
+ *      ili9341_te_wait_started();          // so fb[i], the older frame, is off the wire
+ *  }
+ *  // ili9341_te_stats.missed: due vblanks where the last frame was still on the wire
+ *  // ili9341_te_fps_x100(): frames per second since ili9341_te_stats_reset()
+ *
+ * TE notes:
+ *  - The frame is written from the top while the panel scans from the top, a
+ *    write started on the edge stays ahead of the first scan and is overtaken
+ *    by the second one, so it is tear free while it takes less than 2 refresh
+ *    periods, whatever the interval. Interval 1 also wants it under 1 period
+ *    or every other vblank is missed. Full 240x320 at 50 MHz SPI is ~25 ms,
+ *    tear free under ~80 Hz refresh, and at interval 1 under ~40 Hz. Lower
+ *    ILI9341_FRAME_RATE (0xB1) until ili9341_te_stats.missed stays at 0.
+ *  - The edge isr sends the window commands itself, don't draw outside of
+ *    ili9341_te_present while pacing is on.
+ *  - Needs BAD_ILI9341_INCLUDE_ISRS, BAD_EXTI_IMPLEMENTATION and
+ *    BAD_EXTI_DISPATCH_ISR_IMPLEMENTATION in one of the app's files, the TE pin
+ *    set up as an input, and dwt_cycle_counter_enable for the refresh and FPS
+ *    numbers.
+ *  - te_setup/te_off take and drop a SYSCFG reference with rcc_periph_enable,
+ *    keep SYSCFGEN out of rcc_set_apb2_clocking masks and take it the same way.
  */
 
 #pragma once
@@ -46,7 +97,6 @@
 #endif
 
 
-
 #if defined (BAD_ILI9341_IMPLEMENTATION) && defined (BAD_ILI9341_INCLUDE_ISRS)
 #define BAD_DMA_DMA2_STREAM2_USE_TC
 #define BAD_DMA_DMA2_STREAM2_ISR_IMPLEMENTATION
@@ -67,10 +117,17 @@
 #define BAD_ILI9341_DEF extern
 #endif
 
+#ifdef BAD_ILI9341_RAMFUNC
+#define BAD_ILI9341_HOT ATTR_RAMFUNC
+#else
+#define BAD_ILI9341_HOT
+#endif
+
 
 
 
 #define ILI9341_SPI                     (SPI1)
+#define ILI9341_SPI_CLOCK               (RCC_PERIPH_SPI1)
 #define ILI9341_SPI_FEATURES_CMD        (SPI_FEATURE_MASTER|SPI_FEATURE_PRECALER_div_2|SPI_FEATURE_SOFTWARE_CS|\
                                         SPI_FEATURE_BIDIOE_TX_ONLY|SPI_FEATURE_BIDIRECTIONAL|\
                                         SPI_FEATURE_FRAME_FORMAT_8bit)
@@ -84,9 +141,13 @@
 #define ILI9341_RESET_PIN               (8)
 #define ILI9341_DC_PIN                  (7)
 #define ILI9341_CS_PIN                  (6)
+#define ILI9341_RESET_DESC              IO_PIN_DESC(ILI9341_GPIO_PORT, ILI9341_RESET_PIN)
+#define ILI9341_DC_DESC                 IO_PIN_DESC(ILI9341_GPIO_PORT, ILI9341_DC_PIN)
+#define ILI9341_CS_DESC                 IO_PIN_DESC(ILI9341_GPIO_PORT, ILI9341_CS_PIN)
 
 #define ILI9341_DMA_STREAM              (DMA_STREAM2)
 #define ILI9341_DMA                     (DMA2)
+#define ILI9341_DMA_CLOCK               (RCC_PERIPH_DMA2)
 #define ILI9341_DMA_CHANNEL             (DMA_channel2)
 #define ILI9341_DMA_SETTINGS_FB         (DMA_feature_DIR_mem_to_periph| DMA_feature_MINC|\
                                         DMA_feature_PSIZE_half_word |\
@@ -95,18 +156,118 @@
 #define ILI9341_DMA_SETTINGS_FILL       (DMA_feature_DIR_mem_to_periph| DMA_feature_PSIZE_half_word |DMA_feature_MSIZE_half_word)
 #define ILI9341_NVIC_DMA_INTERRUPT      (NVIC_DMA2_STREAM2_INTR)
 
+//TE output of the panel, only used with BAD_ILI9341_USE_TE
+#define ILI9341_TE_PIN                  (9)
+#define ILI9341_TE_SYSCFG_PORT          (SYSCFG_PBx)
+#define ILI9341_NVIC_TE_INTERRUPT       (NVIC_EXTI9_5_INTR)
+
+//native portrait panel size, ili9341_width/height give the rotated one
 #define ILI9341_LCD_HEIGHT              (320)
 #define ILI9341_LCD_WIDTH               (240)
 
+#define ILI9341_MADCTL_MY               (0x80)
+#define ILI9341_MADCTL_MX               (0x40)
+#define ILI9341_MADCTL_MV               (0x20)
+#define ILI9341_MADCTL_BGR              (0x08)
+
+typedef enum{
+    ILI9341_ROTATION_0 = 0,     //portrait 240x320, MADCTL 0x48
+    ILI9341_ROTATION_90,        //landscape 320x240
+    ILI9341_ROTATION_180,
+    ILI9341_ROTATION_270,
+}ILI9341_rotation_t;
+
+//FRAME RATE CONTROL (0xB1) DIVA << 8 | RTNA, refresh of the 615 kHz oscillator
+typedef enum{
+    ILI9341_FRAME_RATE_119HZ = 0x0010,
+    ILI9341_FRAME_RATE_100HZ = 0x0013,
+    ILI9341_FRAME_RATE_90HZ  = 0x0015,
+    ILI9341_FRAME_RATE_79HZ  = 0x0018,     //reset value
+    ILI9341_FRAME_RATE_70HZ  = 0x001B,
+    ILI9341_FRAME_RATE_61HZ  = 0x001F,
+    ILI9341_FRAME_RATE_40HZ  = 0x0118,     //fosc / 2
+    ILI9341_FRAME_RATE_30HZ  = 0x011F,
+}ILI9341_frame_rate_t;
+
+//set by ili9341_init, ili9341_set_frame_rate changes it later
+#ifndef ILI9341_FRAME_RATE
+#define ILI9341_FRAME_RATE              (ILI9341_FRAME_RATE_79HZ)
+#endif
+
+#ifdef BAD_ILI9341_USE_TE
+typedef struct{
+    uint32_t vblanks;       //TE edges
+    uint32_t frames;        //frames started on an edge
+    uint32_t missed;        //due edges with a frame queued but the last one still on the wire
+    uint32_t idle;          //due edges with nothing queued, the app is the bottleneck
+    uint32_t vblank_cycles; //DWT cycles between the last two edges
+}ILI9341_te_stats_t;
+
+extern volatile ILI9341_te_stats_t ili9341_te_stats;
+#endif
+
+//compile time version of the size asserts in the DMA fills, for constant framebuffer sizes
+#define ILI9341_FB_STATIC_CHECK(width,height) \
+    STATIC_ASSERT((width) * (height) < UINT16_MAX, "framebuffer doesn't fit in one DMA transfer"); \
+    STATIC_ASSERT(((width) <= ILI9341_LCD_WIDTH && (height) <= ILI9341_LCD_HEIGHT) || \
+                  ((width) <= ILI9341_LCD_HEIGHT && (height) <= ILI9341_LCD_WIDTH), "framebuffer bigger than the screen")
+
 BAD_ILI9341_DEF void ili9341_init(void);
 BAD_ILI9341_DEF void ili9341_fill(uint16_t color);
 BAD_ILI9341_DEF void ili9341_fb_dma_fill_centered(uint16_t* fb, uint16_t width, uint16_t height);
-BAD_ILI9341_DEF void ili9341_fb_dma_fill(uint16_t* fb, uint16_t x_start, uint16_t y_start,uint16_t x_end,uint16_t y_end);
+BAD_ILI9341_DEF BAD_ILI9341_HOT void ili9341_fb_dma_fill(uint16_t* fb, uint16_t x_start, uint16_t y_start,uint16_t x_end,uint16_t y_end);
 BAD_ILI9341_DEF uint8_t ili9341_poll_dma_ready();
+BAD_ILI9341_DEF void ili9341_wait_dma_ready();
+BAD_ILI9341_DEF void ili9341_set_rotation(ILI9341_rotation_t rotation);
+BAD_ILI9341_DEF uint16_t ili9341_width(void);
+BAD_ILI9341_DEF uint16_t ili9341_height(void);
+BAD_ILI9341_DEF void ili9341_scroll_setup(uint16_t top_fixed, uint16_t bottom_fixed);
+BAD_ILI9341_DEF void ili9341_scroll_to(uint16_t offset);
+BAD_ILI9341_DEF uint16_t ili9341_scroll_line(uint16_t rows);
+BAD_ILI9341_DEF void ili9341_scroll_off(void);
+BAD_ILI9341_DEF void ili9341_set_frame_rate(ILI9341_frame_rate_t rate);
+#ifdef BAD_ILI9341_USE_TE
+BAD_ILI9341_DEF void ili9341_te_setup(uint8_t interval);
+BAD_ILI9341_DEF void ili9341_te_off(void);
+BAD_ILI9341_DEF void ili9341_te_present(uint16_t* fb, uint16_t x_start, uint16_t y_start,uint16_t x_end,uint16_t y_end);
+BAD_ILI9341_DEF void ili9341_te_wait_started(void);
+BAD_ILI9341_DEF void ili9341_te_wait_done(void);
+BAD_ILI9341_DEF void ili9341_te_stats_reset(void);
+BAD_ILI9341_DEF uint32_t ili9341_te_refresh_x100(void);
+BAD_ILI9341_DEF uint32_t ili9341_te_fps_x100(void);
+#endif
 
 
 #ifdef BAD_ILI9341_IMPLEMENTATION
 
+static const uint8_t ili9341_madctl[4] = {
+    ILI9341_MADCTL_MX | ILI9341_MADCTL_BGR,
+    ILI9341_MADCTL_MV | ILI9341_MADCTL_BGR,
+    ILI9341_MADCTL_MY | ILI9341_MADCTL_BGR,
+    ILI9341_MADCTL_MX | ILI9341_MADCTL_MY | ILI9341_MADCTL_MV | ILI9341_MADCTL_BGR,
+};
+
+//zeroed is portrait with scrolling off
+static uint8_t ili9341_rotation;
+static uint16_t ili9341_scroll_top;     //first scrolling panel row
+static uint16_t ili9341_scroll_height;  //0 with scrolling off
+static uint16_t ili9341_scroll_offset;  //0..height-1
+
+#ifdef BAD_ILI9341_USE_TE
+volatile ILI9341_te_stats_t ili9341_te_stats;
+
+static struct{
+    uint16_t *fb;
+    uint16_t x_start, y_start, x_end, y_end;
+}ili9341_te_frame;
+
+static volatile uint8_t ili9341_te_pending;     //ili9341_te_frame waits for an edge
+static volatile uint8_t ili9341_te_in_flight;   //cleared by the TC isr, not NDTR, the SPI is back in cmd mode then
+static uint8_t ili9341_te_interval;
+static uint8_t ili9341_te_phase;                //edges since the last frame started, saturates at interval
+static uint32_t ili9341_te_last_edge;
+#endif
+
 ALWAYS_INLINE void ili9341_spi_fb_transmition_mode(){
     spi_disable(ILI9341_SPI);
     spi_setup(ILI9341_SPI,ILI9341_SPI_FEATURES_DMA,0,0);
@@ -119,25 +280,31 @@ ALWAYS_INLINE void ili9341_spi_control_transmition_mode(){
     spi_enable(ILI9341_SPI);
 }
 
-ALWAYS_INLINE void ili9341_select(void)     { io_pin_reset(ILI9341_GPIO_PORT, ILI9341_CS_PIN); }
-ALWAYS_INLINE void ili9341_deselect(void)   { io_pin_set(ILI9341_GPIO_PORT, ILI9341_CS_PIN); }
-ALWAYS_INLINE void ili9341_enable(void)     { io_pin_set(ILI9341_GPIO_PORT, ILI9341_RESET_PIN); }
-ALWAYS_INLINE void ili9341_disable(void)    { io_pin_reset(ILI9341_GPIO_PORT, ILI9341_RESET_PIN); }
-ALWAYS_INLINE void ili9341_dc_command(void) { io_pin_reset(ILI9341_GPIO_PORT, ILI9341_DC_PIN); }
-ALWAYS_INLINE void ili9341_dc_data(void)    { io_pin_set(ILI9341_GPIO_PORT, ILI9341_DC_PIN); }
+ALWAYS_INLINE void ili9341_select(void)     { io_desc_reset(ILI9341_CS_DESC); }
+ALWAYS_INLINE void ili9341_deselect(void)   { io_desc_set(ILI9341_CS_DESC); }
+ALWAYS_INLINE void ili9341_enable(void)     { io_desc_set(ILI9341_RESET_DESC); }
+ALWAYS_INLINE void ili9341_disable(void)    { io_desc_reset(ILI9341_RESET_DESC); }
+ALWAYS_INLINE void ili9341_dc_command(void) { io_desc_reset(ILI9341_DC_DESC); }
+ALWAYS_INLINE void ili9341_dc_data(void)    { io_desc_set(ILI9341_DC_DESC); }
 
 #ifdef BAD_ILI9341_INCLUDE_ISRS
 
-STRONG_USER_ISR(dma2_stream2_tc,uint16_t offset){
+BAD_ILI9341_HOT STRONG_USER_ISR(dma2_stream2_tc,uint16_t offset){
     UNUSED(offset);
     ili9341_deselect();
     ili9341_spi_control_transmition_mode();
+#ifdef BAD_ILI9341_USE_TE
+    ili9341_te_in_flight = 0;
+#endif
 } 
 
 #endif
 
 
+//turns on its own SPI and DMA clocks, the GPIO port has to be set up already
 ALWAYS_INLINE void ili9341_spi_init(){
+    rcc_periph_enable(ILI9341_SPI_CLOCK);
+    rcc_periph_enable(ILI9341_DMA_CLOCK);
     spi_setup(ILI9341_SPI, ILI9341_SPI_FEATURES_CMD,0, 0);
     spi_enable(ILI9341_SPI);
 }
@@ -169,10 +336,94 @@ ALWAYS_INLINE void ili9341_send_data(uint8_t data)
     ili9341_deselect();
 }
 
-BAD_ILI9341_DEF uint8_t ili9341_poll_dma_ready(){
+BAD_ILI9341_DEF BAD_ILI9341_HOT uint8_t ili9341_poll_dma_ready(){
     return dma_stream_n_poll_ready(ILI9341_DMA, ILI9341_DMA_STREAM);
 }
 
+//WFI until the transfer complete interrupt, needs the dma2_stream2 isr enabled
+BAD_ILI9341_DEF void ili9341_wait_dma_ready(){
+    IDLE_WAIT_UNTIL(ili9341_poll_dma_ready());
+}
+
+BAD_ILI9341_DEF uint16_t ili9341_width(void){
+    return ili9341_rotation & 1 ? ILI9341_LCD_HEIGHT : ILI9341_LCD_WIDTH;
+}
+
+BAD_ILI9341_DEF uint16_t ili9341_height(void){
+    return ili9341_rotation & 1 ? ILI9341_LCD_WIDTH : ILI9341_LCD_HEIGHT;
+}
+
+ALWAYS_INLINE void ili9341_send_data16(uint16_t data){
+    ili9341_send_data(data >> 8);
+    ili9341_send_data(data & 0xFF);
+}
+
+ALWAYS_INLINE void ili9341_set_window(uint16_t x_start, uint16_t y_start, uint16_t x_end, uint16_t y_end){
+    ili9341_send_cmd(0x2A); // column addr set
+    ili9341_send_data16(x_start);
+    ili9341_send_data16(x_end);
+    ili9341_send_cmd(0x2B); // row addr set
+    ili9341_send_data16(y_start);
+    ili9341_send_data16(y_end);
+    ili9341_send_cmd(0x2C); // memory write
+}
+
+BAD_ILI9341_DEF void ili9341_set_rotation(ILI9341_rotation_t rotation){
+    ILI9341_ASSERT(rotation <= ILI9341_ROTATION_270);
+    ili9341_rotation = rotation;
+    //MEMORY ACCESS CONTROL
+    ili9341_send_cmd(0x36);
+    ili9341_send_data(ili9341_madctl[rotation]);
+}
+
+//Rows between the fixed areas scroll, VSCRSADD is left at the top of the area
+BAD_ILI9341_DEF void ili9341_scroll_setup(uint16_t top_fixed, uint16_t bottom_fixed){
+    ILI9341_ASSERT(top_fixed + bottom_fixed < ILI9341_LCD_HEIGHT);
+    ili9341_scroll_top = top_fixed;
+    ili9341_scroll_height = ILI9341_LCD_HEIGHT - top_fixed - bottom_fixed;
+    //VERTICAL SCROLLING DEFINITION
+    ili9341_send_cmd(0x33);
+    ili9341_send_data16(top_fixed);
+    ili9341_send_data16(ili9341_scroll_height);
+    ili9341_send_data16(bottom_fixed);
+    ili9341_scroll_to(0);
+}
+
+//offset rows of the area are scrolled out at the top and shown again at the bottom,
+//does nothing with scrolling off
+BAD_ILI9341_DEF void ili9341_scroll_to(uint16_t offset){
+    if (!ili9341_scroll_height) {
+        return;
+    }
+    ili9341_scroll_offset = offset % ili9341_scroll_height;
+    //VERTICAL SCROLLING START ADDRESS
+    ili9341_send_cmd(0x37);
+    ili9341_send_data16(ili9341_scroll_top + ili9341_scroll_offset);
+}
+
+//Scrolls a line of rows in and returns where to draw it, the rows that just
+//left the top are now the bottom ones
+BAD_ILI9341_DEF uint16_t ili9341_scroll_line(uint16_t rows){
+    uint16_t line = ili9341_scroll_top + ili9341_scroll_offset;
+    ILI9341_ASSERT(ili9341_scroll_offset + rows <= ili9341_scroll_height);
+    ili9341_scroll_to(ili9341_scroll_offset + rows);
+    return line;
+}
+
+BAD_ILI9341_DEF void ili9341_scroll_off(void){
+    ili9341_scroll_height = 0;
+    ili9341_scroll_offset = 0;
+    //NORMAL DISPLAY MODE ON
+    ili9341_send_cmd(0x13);
+}
+
+BAD_ILI9341_DEF void ili9341_set_frame_rate(ILI9341_frame_rate_t rate){
+    //FRAME RATIO CONTROL, STANDARD RGB COLOR
+    ili9341_send_cmd(0xB1);
+    ili9341_send_data(rate >> 8);
+    ili9341_send_data(rate & 0xFF);
+}
+
 BAD_ILI9341_DEF void ili9341_init(void)
 {
     ili9341_enable();
@@ -235,18 +486,13 @@ BAD_ILI9341_DEF void ili9341_init(void)
     ili9341_send_cmd(0xC7);
     ili9341_send_data(0x86);
 
-    //MEMORY ACCESS CONTROL
-    ili9341_send_cmd(0x36);
-    ili9341_send_data(0x48);
+    ili9341_set_rotation(ili9341_rotation);
 
     //PIXEL FORMAT
     ili9341_send_cmd(0x3A);
     ili9341_send_data(0x55);
 
-    //FRAME RATIO CONTROL, STANDARD RGB COLOR
-    ili9341_send_cmd(0xB1);
-    ili9341_send_data(0x00);
-    ili9341_send_data(0x18);
+    ili9341_set_frame_rate(ILI9341_FRAME_RATE);
 
     //DISPLAY FUNCTION CONTROL
     ili9341_send_cmd(0xB6);
@@ -310,13 +556,7 @@ BAD_ILI9341_DEF void ili9341_init(void)
 // ==== Example helper: fill screen ====
 BAD_ILI9341_DEF void ili9341_fill(uint16_t color)
 {
-    ili9341_send_cmd(0x2A); // column addr set
-    ili9341_send_data(0x0); ili9341_send_data(0x00);
-    ili9341_send_data(0); ili9341_send_data(0xEF);
-    ili9341_send_cmd(0x2B); // row addr set
-    ili9341_send_data(0x0); ili9341_send_data(0x0);
-    ili9341_send_data(0x1); ili9341_send_data(0x3F);
-    ili9341_send_cmd(0x2C); // memory write
+    ili9341_set_window(0, 0, ili9341_width() - 1, ili9341_height() - 1);
 
     ili9341_select();
     ili9341_dc_data();
@@ -331,20 +571,10 @@ BAD_ILI9341_DEF void ili9341_fb_dma_fill(uint16_t* fb, uint16_t x_start, uint16_
     uint16_t width = (x_end - x_start )+1;
     uint16_t length = (y_end -y_start)+1;
     ILI9341_ASSERT(width*length< UINT16_MAX);
-    ILI9341_ASSERT( x_start < ILI9341_LCD_WIDTH && x_end < ILI9341_LCD_WIDTH && y_start < ILI9341_LCD_HEIGHT && y_end< ILI9341_LCD_HEIGHT);
+    ILI9341_ASSERT( x_start < ili9341_width() && x_end < ili9341_width() && y_start < ili9341_height() && y_end< ili9341_height());
     uint16_t buff_len = width*length;
     nvic_enable_interrupt(ILI9341_NVIC_DMA_INTERRUPT);
-    ili9341_send_cmd(0x2A); // column addr set
-    ili9341_send_data(x_start>>8); 
-    ili9341_send_data(x_start & 0xFF);
-    ili9341_send_data(x_end>>8); 
-    ili9341_send_data(x_end & 0xFF);
-    ili9341_send_cmd(0x2B); // row addr set
-    ili9341_send_data(y_start>>8); 
-    ili9341_send_data(y_start & 0xFF);
-    ili9341_send_data(y_end>>8); 
-    ili9341_send_data(y_end & 0xFF);
-    ili9341_send_cmd(0x2C); // memory write
+    ili9341_set_window(x_start, y_start, x_end, y_end);
     ili9341_spi_fb_transmition_mode();
     dma_setup_transfer(ILI9341_DMA, 
         ILI9341_DMA_STREAM, 
@@ -360,26 +590,16 @@ BAD_ILI9341_DEF void ili9341_fb_dma_fill(uint16_t* fb, uint16_t x_start, uint16_
     
 }
 
-BAD_ILI9341_DEF void ili9341_fb_dma_fill_centered(uint16_t* fb, uint16_t width, uint16_t height){
-    uint16_t x_start =(( ILI9341_LCD_WIDTH - width)>>1);
+BAD_ILI9341_DEF BAD_ILI9341_HOT void ili9341_fb_dma_fill_centered(uint16_t* fb, uint16_t width, uint16_t height){
+    uint16_t x_start =(( ili9341_width() - width)>>1);
     uint16_t x_end = x_start + width - 1;
 
-    uint16_t y_start =((ILI9341_LCD_HEIGHT - height)>>1);
+    uint16_t y_start =((ili9341_height() - height)>>1);
     uint16_t y_end = y_start + height - 1;
     ILI9341_ASSERT(width*height< UINT16_MAX);
     uint16_t buff_len = (width * height);
     nvic_enable_interrupt(ILI9341_NVIC_DMA_INTERRUPT);
-    ili9341_send_cmd(0x2A); // column addr set
-    ili9341_send_data(x_start>>8); 
-    ili9341_send_data(x_start & 0xFF);
-    ili9341_send_data(x_end>>8); 
-    ili9341_send_data(x_end & 0xFF);
-    ili9341_send_cmd(0x2B); // row addr set
-    ili9341_send_data(y_start>>8); 
-    ili9341_send_data(y_start & 0xFF);
-    ili9341_send_data(y_end>>8); 
-    ili9341_send_data(y_end & 0xFF);
-    ili9341_send_cmd(0x2C); // memory write
+    ili9341_set_window(x_start, y_start, x_end, y_end);
     ili9341_spi_fb_transmition_mode();
     dma_setup_transfer(ILI9341_DMA, 
         ILI9341_DMA_STREAM, 
@@ -394,5 +614,117 @@ BAD_ILI9341_DEF void ili9341_fb_dma_fill_centered(uint16_t* fb, uint16_t width,
     ili9341_spi_start_dma();
     
 }
+
+#ifdef BAD_ILI9341_USE_TE
+
+//Rising TE edge, the start of vblank. Starts the queued frame when it is due
+//and the previous one is fully out.
+static BAD_ILI9341_HOT void ili9341_te_edge(uint8_t line){
+    UNUSED(line);
+    uint32_t now = dwt_cycles();
+    if (ili9341_te_stats.vblanks++) {
+        ili9341_te_stats.vblank_cycles = now - ili9341_te_last_edge;
+    }
+    ili9341_te_last_edge = now;
+
+    if (ili9341_te_phase < ili9341_te_interval) {
+        ili9341_te_phase++;
+    }
+    if (ili9341_te_phase < ili9341_te_interval) {
+        return;
+    }
+    if (!ili9341_te_pending) {
+        ili9341_te_stats.idle++;
+        return;
+    }
+    if (ili9341_te_in_flight) {
+        ili9341_te_stats.missed++;
+        return;
+    }
+    ili9341_te_phase = 0;
+    ili9341_te_pending = 0;
+    ili9341_te_in_flight = 1;
+    ili9341_te_stats.frames++;
+    ili9341_fb_dma_fill(ili9341_te_frame.fb, ili9341_te_frame.x_start, ili9341_te_frame.y_start,
+                        ili9341_te_frame.x_end, ili9341_te_frame.y_end);
+}
+
+//interval: TE edges per frame, the first frame may go out on the next edge
+BAD_ILI9341_DEF void ili9341_te_setup(uint8_t interval){
+    ILI9341_ASSERT(interval);
+    ili9341_te_interval = interval;
+    ili9341_te_phase = interval;
+    ili9341_te_pending = 0;
+    ili9341_te_in_flight = 0;
+    //a reference, not the bit, SYSCFG has to come from rcc_periph_enable everywhere
+    rcc_periph_enable(RCC_PERIPH_SYSCFG);
+    //TEARING EFFECT LINE ON, V-blank only
+    ili9341_send_cmd(0x35);
+    ili9341_send_data(0x00);
+    syscfg_set_exti_pin(ILI9341_TE_SYSCFG_PORT, ILI9341_TE_PIN);
+    exti_set_callback(ILI9341_TE_PIN, ili9341_te_edge);
+    exti_configure_line(ILI9341_TE_PIN, EXTI_TRIGGER_RISING);
+    nvic_enable_interrupt(ILI9341_NVIC_TE_INTERRUPT);
+    ili9341_te_stats_reset();
+}
+
+//Drops a queued frame, the one on the wire still finishes
+BAD_ILI9341_DEF void ili9341_te_off(void){
+    exti_mask_line(ILI9341_TE_PIN);
+    ili9341_te_pending = 0;
+    ili9341_wait_dma_ready();
+    //TEARING EFFECT LINE OFF
+    ili9341_send_cmd(0x34);
+    rcc_periph_disable(RCC_PERIPH_SYSCFG);
+}
+
+//Queues fb for the next due edge, waits for an older queued frame to start first
+BAD_ILI9341_DEF void ili9341_te_present(uint16_t* fb, uint16_t x_start, uint16_t y_start,uint16_t x_end,uint16_t y_end){
+    ili9341_te_wait_started();
+    ili9341_te_frame.fb = fb;
+    ili9341_te_frame.x_start = x_start;
+    ili9341_te_frame.y_start = y_start;
+    ili9341_te_frame.x_end = x_end;
+    ili9341_te_frame.y_end = y_end;
+    DMB;
+    ili9341_te_pending = 1;
+}
+
+//The last presented frame is on the wire, the one before it is done
+BAD_ILI9341_DEF void ili9341_te_wait_started(void){
+    IDLE_WAIT_UNTIL(!ili9341_te_pending);
+}
+
+BAD_ILI9341_DEF void ili9341_te_wait_done(void){
+    IDLE_WAIT_UNTIL(!ili9341_te_pending && !ili9341_te_in_flight);
+}
+
+BAD_ILI9341_DEF void ili9341_te_stats_reset(void){
+    uint32_t primask = irq_save();
+    ili9341_te_stats.vblanks = 0;
+    ili9341_te_stats.frames = 0;
+    ili9341_te_stats.missed = 0;
+    ili9341_te_stats.idle = 0;
+    ili9341_te_stats.vblank_cycles = 0;
+    irq_restore(primask);
+}
+
+//Measured panel refresh in 1/100 Hz, checks what ILI9341_FRAME_RATE really gives
+BAD_ILI9341_DEF uint32_t ili9341_te_refresh_x100(void){
+    uint32_t cycles = ili9341_te_stats.vblank_cycles;
+    return cycles < 100 ? 0 : CLOCK_SPEED / (cycles / 100);
+}
+
+//Frames per second in 1/100 Hz since the last reset, reset every few seconds,
+//refresh * frames overflows after ~300k frames
+BAD_ILI9341_DEF uint32_t ili9341_te_fps_x100(void){
+    uint32_t primask = irq_save();
+    uint32_t frames = ili9341_te_stats.frames;
+    uint32_t vblanks = ili9341_te_stats.vblanks;
+    irq_restore(primask);
+    return vblanks ? ili9341_te_refresh_x100() * frames / vblanks : 0;
+}
+
+#endif
 #endif
 #endif
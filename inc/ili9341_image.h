@@ -0,0 +1,159 @@
+/**
+ * @file ili9341_image.h
+ * @brief Header only palette + RLE images for the ILI9341, decoded in stripes
+ *
+ * Images made by tools/image_convert.py live in flash as an RGB565 palette
+ * and a byte RLE stream of palette indices. The decoder expands the stream
+ * straight into one of two stripe buffers, the next stripe is decoded while
+ * the previous one goes out with `ili9341_fb_dma_fill`, so an image of any
+ * size costs two stripes of RAM, and only while it is drawn: the stripes are
+ * pool.h blocks, shared with whatever else uses the pool between draws.
+ *
+ * Usage:
+ *  #define BAD_ILI9341_IMAGE_IMPLEMENTATION
+ *  #include "ili9341_image.h"
+ *  #include "logo.h" // python3 tools/image_convert.py logo.png --name logo -o logo.h
+ *
+ *  // a stripe is a block, 16 rows of 240 here, 16 byte aligned for the bursts
+ *  POOL_DEFINE(dma_blocks, 240 * 16 * sizeof(uint16_t), 3, 16);
+ *
+ *  ili9341_draw_image(&logo, 0, 0, &dma_blocks); // 0 when the pool was empty
+ *
+ *  // or decode by hand, any number of pixels per call
+ *  ILI9341_image_decoder_t dec;
+ *  ili9341_image_decoder_init(&dec, &logo);
+ *  ili9341_image_decode(&dec, buf, 64);
+ *
+ * Notes:
+ *  - Needs the DMA TC isr (`BAD_ILI9341_INCLUDE_ISRS`) and BAD_PWR_IMPLEMENTATION
+ *    somewhere, the waits sleep in ili9341_wait_dma_ready.
+ *  - Two blocks are taken, with only one left decode and DMA take turns on it.
+ *    A block has to hold at least one row (8 for odd widths) and the pool has
+ *    to be 16 byte aligned.
+ *  - Stripes are whole rows and a whole number of the incr4 bursts of
+ *    ILI9341_DMA_SETTINGS_FB: the rows per stripe are rounded down to make
+ *    that so and width * height has to be a multiple of 8 for the last one
+ *    (tools/image_convert.py pads the height).
+ *  - Waits for the last stripe before giving the blocks back, the image is on
+ *    the panel when draw returns.
+ */
+
+#pragma once
+#ifndef BAD_ILI9341_IMAGE_H
+#define BAD_ILI9341_IMAGE_H
+
+#include "ili9341.h"
+#include "pool.h"
+
+//stripes are read by the incr4 word bursts of ILI9341_DMA_SETTINGS_FB
+#define ILI9341_IMAGE_BURST_PIXELS (8)
+
+#define ILI9341_IMAGE_RUN       (0x80)
+#define ILI9341_IMAGE_LEN_MASK  (0x7F)
+
+typedef struct{
+    const uint16_t *palette;
+    const uint8_t *data;
+    uint16_t width;
+    uint16_t height;
+}ILI9341_image_t;
+
+typedef struct{
+    const ILI9341_image_t *image;
+    const uint8_t *src;
+    uint8_t remaining;      //pixels left in the current token
+    uint8_t is_run;
+    uint16_t color;         //of the current run
+}ILI9341_image_decoder_t;
+
+ALWAYS_STATIC void ili9341_image_decoder_init(ILI9341_image_decoder_t *dec, const ILI9341_image_t *image){
+    dec->image = image;
+    dec->src = image->data;
+    dec->remaining = 0;
+    dec->is_run = 0;
+}
+
+BAD_ILI9341_DEF BAD_ILI9341_HOT void ili9341_image_decode(ILI9341_image_decoder_t *dec, uint16_t *out, uint32_t pixels);
+BAD_ILI9341_DEF uint8_t ili9341_draw_image(const ILI9341_image_t *image, uint16_t x, uint16_t y, pool_t *pool);
+
+#ifdef BAD_ILI9341_IMAGE_IMPLEMENTATION
+
+//Tokens can end anywhere, the decoder carries a half used run or literal over to the next call
+BAD_ILI9341_DEF BAD_ILI9341_HOT void ili9341_image_decode(ILI9341_image_decoder_t *dec, uint16_t *out, uint32_t pixels){
+    const uint16_t *palette = dec->image->palette;
+    const uint8_t *src = dec->src;
+    uint32_t remaining = dec->remaining;
+
+    while (pixels) {
+        if (!remaining) {
+            uint8_t token = *src++;
+            remaining = (token & ILI9341_IMAGE_LEN_MASK) + 1;
+            dec->is_run = token & ILI9341_IMAGE_RUN;
+            if (dec->is_run) {
+                dec->color = palette[*src++];
+            }
+        }
+        uint32_t n = remaining < pixels ? remaining : pixels;
+        remaining -= n;
+        pixels -= n;
+        if (dec->is_run) {
+            uint16_t color = dec->color;
+            while (n--) {
+                *out++ = color;
+            }
+        } else {
+            while (n--) {
+                *out++ = palette[*src++];
+            }
+        }
+    }
+    dec->src = src;
+    dec->remaining = remaining;
+}
+
+//Returns 0 without drawing when the pool has no block left or its blocks are too small
+BAD_ILI9341_DEF uint8_t ili9341_draw_image(const ILI9341_image_t *image, uint16_t x, uint16_t y, pool_t *pool){
+    ILI9341_ASSERT(x + image->width <= ili9341_width() && y + image->height <= ili9341_height());
+    ILI9341_ASSERT(((uint32_t)image->width * image->height) % ILI9341_IMAGE_BURST_PIXELS == 0);
+    ILI9341_ASSERT(pool->block_size % (ILI9341_IMAGE_BURST_PIXELS * sizeof(uint16_t)) == 0);
+    ILI9341_image_decoder_t dec;
+    uint16_t *stripes[2];
+    //fewest rows that make whole bursts, 8 / gcd(width, 8)
+    uint16_t row_step = 1;
+    while ((image->width * row_step) % ILI9341_IMAGE_BURST_PIXELS) {
+        row_step++;
+    }
+    uint16_t rows = pool->block_size / sizeof(uint16_t) / image->width / row_step * row_step;
+    uint8_t next = 0;
+
+    stripes[0] = rows ? pool_alloc(pool) : 0; //blocks too small for one burst of rows
+    if (!stripes[0]) {
+        return 0;
+    }
+    stripes[1] = pool_alloc(pool);
+    ILI9341_ASSERT(((uintptr_t)stripes[0] & 0xF) == 0);
+
+    ili9341_image_decoder_init(&dec, image);
+    for (uint16_t row = 0; row < image->height; row += rows) {
+        uint16_t stripe_rows = image->height - row < rows ? image->height - row : rows;
+        uint16_t *stripe = stripes[next];
+        if (!stripes[1]) {
+            ili9341_wait_dma_ready(); //single block, it is the one on the wire
+        }
+        //the other stripe may still be on the wire, this one finished before it started
+        ili9341_image_decode(&dec, stripe, (uint32_t)stripe_rows * image->width);
+        ili9341_wait_dma_ready();
+        ili9341_fb_dma_fill(stripe, x, y + row, x + image->width - 1, y + row + stripe_rows - 1);
+        next = stripes[1] ? next ^ 1 : 0;
+    }
+    ili9341_wait_dma_ready();
+    pool_free(pool, stripes[0]);
+    if (stripes[1]) {
+        pool_free(pool, stripes[1]);
+    }
+    return 1;
+}
+
+#endif
+
+#endif
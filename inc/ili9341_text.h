@@ -0,0 +1,208 @@
+/**
+ * @file ili9341_text.h
+ * @brief Header only text rendering for the ILI9341, fixed cell fonts from flash
+ *
+ * Glyphs are 1 bpp or 4 bpp (16 level anti aliased) bitmaps made by
+ * tools/font_convert.py. Every glyph is expanded to RGB565 and sent as its
+ * own `ili9341_fb_dma_fill` window, the next glyph is expanded while the
+ * previous one is still on the wire. Glyphs put in the cache (digits for
+ * readouts) are kept expanded in RAM and DMAd straight from there. Both the
+ * two expansion buffers and the cached glyphs are pool.h blocks, the first
+ * are given back when draw returns, the others by ili9341_text_uncache.
+ *
+ * Usage:
+ *  #define BAD_ILI9341_TEXT_IMPLEMENTATION
+ *  #include "ili9341_text.h"
+ *  #include "fonts/font_mono_16.h"
+ *
+ *  // a glyph per block, 16 byte aligned for the bursts
+ *  POOL_DEFINE(glyph_blocks, 10 * 20 * sizeof(uint16_t), 14, 16); // font_mono_16 is 10x20
+ *
+ *  ILI9341_text_style_t style;
+ *  ili9341_text_style(&style, &font_mono_16, 0xFFFF, 0x0000);
+ *  ili9341_text_cache(&style, "0123456789.-", &glyph_blocks); // 12 blocks held
+ *
+ *  ili9341_draw_text(&style, 10, 10, "TEMP", &glyph_blocks);
+ *  ili9341_draw_text(&style, 10, 40, "23.5", &glyph_blocks); // four DMA bursts, no expansion
+ *  ili9341_text_uncache();                                    // 12 blocks back
+ *
+ * Notes:
+ *  - Needs the DMA TC isr (`BAD_ILI9341_INCLUDE_ISRS`) and BAD_PWR_IMPLEMENTATION
+ *    somewhere, the waits sleep in ili9341_wait_dma_ready.
+ *  - A block has to hold a whole glyph and the pool has to be 16 byte aligned.
+ *    draw takes two blocks on the first glyph that isn't cached, with only one
+ *    left expansion and DMA take turns, with none it stops there.
+ *  - draw waits for the last glyph before giving its blocks back.
+ *  - One cache, it belongs to the style last passed to ili9341_text_cache,
+ *    `ILI9341_TEXT_CACHE_GLYPHS` (default 12) glyphs at most.
+ */
+
+#pragma once
+#ifndef BAD_ILI9341_TEXT_H
+#define BAD_ILI9341_TEXT_H
+
+#include "ili9341.h"
+#include "pool.h"
+
+#ifndef ILI9341_TEXT_CACHE_GLYPHS
+#define ILI9341_TEXT_CACHE_GLYPHS (12)
+#endif
+
+//glyph buffers are read by the incr4 word bursts of ILI9341_DMA_SETTINGS_FB
+#define ILI9341_TEXT_BURST_PIXELS (8)
+
+typedef struct{
+    const uint8_t *glyphs;  //row major, MSB first, rows padded to a byte
+    uint8_t first;
+    uint8_t last;
+    uint8_t width;
+    uint8_t height;
+    uint8_t bpp;            //1 or 4
+    uint8_t row_bytes;
+    uint16_t glyph_bytes;
+}ILI9341_font_t;
+
+typedef struct{
+    const ILI9341_font_t *font;
+    uint16_t lut[16];       //coverage level -> RGB565, 1 bpp uses 0 and 15
+}ILI9341_text_style_t;
+
+BAD_ILI9341_DEF void ili9341_text_style(ILI9341_text_style_t *style, const ILI9341_font_t *font, uint16_t fg, uint16_t bg);
+BAD_ILI9341_DEF BAD_ILI9341_HOT void ili9341_text_expand(const ILI9341_text_style_t *style, char c, uint16_t *out);
+BAD_ILI9341_DEF uint8_t ili9341_text_cache(const ILI9341_text_style_t *style, const char *chars, pool_t *pool);
+BAD_ILI9341_DEF void ili9341_text_uncache(void);
+BAD_ILI9341_DEF uint16_t ili9341_draw_text(const ILI9341_text_style_t *style, uint16_t x, uint16_t y, const char *str, pool_t *pool);
+
+#ifdef BAD_ILI9341_TEXT_IMPLEMENTATION
+
+static uint16_t *ili9341_text_cached[ILI9341_TEXT_CACHE_GLYPHS];
+static char ili9341_text_cached_chars[ILI9341_TEXT_CACHE_GLYPHS];
+static pool_t *ili9341_text_cache_pool;
+static uint8_t ili9341_text_cached_count;
+static const ILI9341_text_style_t *ili9341_text_cache_owner;
+
+//per channel blend in RGB565, level 0..15
+static uint16_t ili9341_text_blend(uint16_t fg, uint16_t bg, uint8_t level){
+    uint16_t r = (((fg >> 11) & 0x1F) * level + ((bg >> 11) & 0x1F) * (15 - level) + 7) / 15;
+    uint16_t g = (((fg >> 5) & 0x3F) * level + ((bg >> 5) & 0x3F) * (15 - level) + 7) / 15;
+    uint16_t b = ((fg & 0x1F) * level + (bg & 0x1F) * (15 - level) + 7) / 15;
+    return (r << 11) | (g << 5) | b;
+}
+
+BAD_ILI9341_DEF void ili9341_text_style(ILI9341_text_style_t *style, const ILI9341_font_t *font, uint16_t fg, uint16_t bg){
+    ILI9341_ASSERT((font->width * font->height) % ILI9341_TEXT_BURST_PIXELS == 0);
+    if (ili9341_text_cache_owner == style) {
+        ili9341_text_uncache(); //colors change under the cache
+    }
+    style->font = font;
+    for (uint8_t level = 0; level < 16; level++) {
+        style->lut[level] = ili9341_text_blend(fg, bg, level);
+    }
+}
+
+//Chars outside the font come out as the first glyph (a space for the default range)
+BAD_ILI9341_DEF BAD_ILI9341_HOT void ili9341_text_expand(const ILI9341_text_style_t *style, char c, uint16_t *out){
+    const ILI9341_font_t *font = style->font;
+    uint8_t index = ((uint8_t)c >= font->first && (uint8_t)c <= font->last) ? (uint8_t)c - font->first : 0;
+    const uint8_t *row = &font->glyphs[index * font->glyph_bytes];
+
+    for (uint8_t y = 0; y < font->height; y++, row += font->row_bytes) {
+        if (font->bpp == 1) {
+            for (uint8_t x = 0; x < font->width; x++) {
+                *out++ = (row[x >> 3] << (x & 7)) & 0x80 ? style->lut[15] : style->lut[0];
+            }
+        } else {
+            for (uint8_t x = 0; x < font->width; x++) {
+                uint8_t pair = row[x >> 1];
+                *out++ = style->lut[x & 1 ? pair & 0xF : pair >> 4];
+            }
+        }
+    }
+}
+
+//Gives the blocks of the current cache back, waits for a cached glyph still on the wire
+BAD_ILI9341_DEF void ili9341_text_uncache(void){
+    ili9341_wait_dma_ready();
+    for (uint8_t i = 0; i < ili9341_text_cached_count; i++) {
+        pool_free(ili9341_text_cache_pool, ili9341_text_cached[i]);
+    }
+    ili9341_text_cached_count = 0;
+    ili9341_text_cache_owner = 0;
+}
+
+//Replaces the cache, returns the glyphs cached, fewer than asked when the pool runs out
+BAD_ILI9341_DEF uint8_t ili9341_text_cache(const ILI9341_text_style_t *style, const char *chars, pool_t *pool){
+    uint32_t glyph_bytes = (uint32_t)style->font->width * style->font->height * sizeof(uint16_t);
+    uint8_t count = 0;
+    ili9341_text_uncache();
+    ili9341_text_cache_pool = pool;
+    while (*chars && count < ILI9341_TEXT_CACHE_GLYPHS && pool->block_size >= glyph_bytes) {
+        uint16_t *glyph = pool_alloc(pool);
+        if (!glyph) {
+            break;
+        }
+        ILI9341_ASSERT(((uintptr_t)glyph & 0xF) == 0);
+        ili9341_text_expand(style, *chars, glyph);
+        ili9341_text_cached[count] = glyph;
+        ili9341_text_cached_chars[count++] = *chars++;
+    }
+    ili9341_text_cached_count = count;
+    ili9341_text_cache_owner = style;
+    return count;
+}
+
+static const uint16_t *ili9341_text_lookup(const ILI9341_text_style_t *style, char c){
+    if (style != ili9341_text_cache_owner) {
+        return 0;
+    }
+    for (uint8_t i = 0; i < ili9341_text_cached_count; i++) {
+        if (ili9341_text_cached_chars[i] == c) {
+            return ili9341_text_cached[i];
+        }
+    }
+    return 0;
+}
+
+//Returns the x after the last glyph, stops at the right edge or when no block is left
+BAD_ILI9341_DEF uint16_t ili9341_draw_text(const ILI9341_text_style_t *style, uint16_t x, uint16_t y, const char *str, pool_t *pool){
+    const ILI9341_font_t *font = style->font;
+    uint32_t glyph_bytes = (uint32_t)font->width * font->height * sizeof(uint16_t);
+    uint16_t *scratch[2] = {0, 0};
+    uint8_t next = 0;
+    ILI9341_ASSERT(y + font->height <= ili9341_height());
+
+    for (; *str && x + font->width <= ili9341_width(); str++, x += font->width) {
+        const uint16_t *pixels = ili9341_text_lookup(style, *str);
+        if (!pixels) {
+            if (!scratch[0]) {
+                scratch[0] = pool->block_size >= glyph_bytes ? pool_alloc(pool) : 0;
+                if (!scratch[0]) {
+                    break;
+                }
+                scratch[1] = pool_alloc(pool);
+                ILI9341_ASSERT(((uintptr_t)scratch[0] & 0xF) == 0);
+            }
+            if (!scratch[1]) {
+                ili9341_wait_dma_ready(); //single block, it is the one on the wire
+            }
+            //the other scratch buffer may still be in flight, this one finished before it started
+            ili9341_text_expand(style, *str, scratch[next]);
+            pixels = scratch[next];
+            next = scratch[1] ? next ^ 1 : 0;
+        }
+        ili9341_wait_dma_ready();
+        ili9341_fb_dma_fill((uint16_t *)pixels, x, y, x + font->width - 1, y + font->height - 1);
+    }
+    if (scratch[0]) {
+        ili9341_wait_dma_ready();
+        pool_free(pool, scratch[0]);
+        if (scratch[1]) {
+            pool_free(pool, scratch[1]);
+        }
+    }
+    return x;
+}
+
+#endif
+
+#endif
@@ -0,0 +1,137 @@
+/**
+ * @file pool.h
+ * @brief Header only fixed block pool allocator, O(1) and isr safe
+ *
+ * A pool is `count` blocks of one size carved out of a static array. Freed
+ * blocks go on a lock-free LIFO list, blocks never handed out yet are taken
+ * from a bump index, so a zeroed pool is a full one and needs no init call.
+ *
+ * Usage:
+ *  #include "pool.h"
+ *
+ *  // 4 display stripes, 16 byte aligned for DMA_feature_MBURST_incr4 words
+ *  POOL_DEFINE(stripes, 240 * 20 * sizeof(uint16_t), 4, 16);
+ *
+ *  uint16_t *stripe = pool_alloc(&stripes);   // main or any isr
+ *  if (stripe) {
+ *      ...
+ *      pool_free(&stripes, stripe);           // e.g. from the DMA TC callback
+ *  }
+ *
+ *  // sizing: the most blocks ever out at once and allocations that failed
+ *  pool_high_water(&stripes); pool_exhausted(&stripes);
+ *
+ * Notes:
+ *  - The list head is a 16 bit tag + 16 bit block link updated with
+ *    ring.h's LDREX/STREX compare and swap, the tag keeps the C11 host
+ *    backend ABA safe too (tests/host/pool_test.c).
+ *  - Free blocks keep the list link in their first word, the rest of a
+ *    block is left alone, nothing is cleared on alloc.
+ *  - Blocks are aligned and rounded up to `align`, at least a word, so the
+ *    list link is never an unaligned access.
+ */
+
+#pragma once
+#ifndef BAD_POOL_H
+#define BAD_POOL_H
+
+#include "ring.h"
+
+#define POOL_LINK_MASK  (0xFFFFU)   //block index + 1, 0 ends the list
+#define POOL_MAX_BLOCKS (0xFFFEU)
+#define POOL_TAG_STEP   (0x10000U)
+
+typedef struct{
+    uint8_t *mem;
+    uint32_t block_size;        //stride, a multiple of the alignment
+    uint32_t count;
+    ring_index_t head;          //tag << 16 | link to the first free block
+    ring_index_t fresh;         //blocks below it have been handed out at least once
+    ring_index_t used;
+    ring_index_t high_water;
+    ring_index_t exhausted;     //allocations that found the pool empty
+}pool_t;
+
+#define POOL_ALIGN(align) ((align) < 4 ? 4 : (align))
+#define POOL_STRIDE(size, align) ((((size) < 4 ? 4 : (size)) + POOL_ALIGN(align) - 1) / POOL_ALIGN(align) * POOL_ALIGN(align))
+
+#define POOL_DEFINE(name, size, blocks, align)                                          \
+    _Static_assert(RING_IS_POW2(align), #name " alignment has to be a power of two");   \
+    _Static_assert((blocks) > 0 && (blocks) <= POOL_MAX_BLOCKS, #name " too many blocks"); \
+    static uint8_t name##_mem[(blocks) * POOL_STRIDE(size, align)] __attribute__((aligned(POOL_ALIGN(align)))); \
+    pool_t name = {name##_mem, POOL_STRIDE(size, align), (blocks), 0, 0, 0, 0, 0}
+
+RING_INLINE uint32_t *pool_link(pool_t *pool, uint32_t index){
+    return (uint32_t *)(void *)&pool->mem[index * pool->block_size];
+}
+
+RING_INLINE void pool_count_alloc(pool_t *pool){
+    uint32_t used, high;
+    do {
+        used = pool->used;
+    } while (!ring_cas(&pool->used, used, used + 1));
+    do {
+        high = pool->high_water;
+    } while (high < used + 1 && !ring_cas(&pool->high_water, high, used + 1));
+}
+
+RING_INLINE void *pool_alloc(pool_t *pool){
+    uint32_t head, index;
+    while (1) {
+        head = pool->head;
+        if (!(head & POOL_LINK_MASK)) {
+            break;
+        }
+        index = (head & POOL_LINK_MASK) - 1;
+        //next may be stale if another context takes the block first, the tag makes the CAS fail then
+        uint32_t next = *pool_link(pool, index);
+        if (ring_cas(&pool->head, head, ((head + POOL_TAG_STEP) & ~POOL_LINK_MASK) | next)) {
+            pool_count_alloc(pool);
+            return pool_link(pool, index);
+        }
+    }
+    while (1) {
+        index = pool->fresh;
+        if (index >= pool->count) {
+            ring_atomic_inc(&pool->exhausted);
+            return 0;
+        }
+        if (ring_cas(&pool->fresh, index, index + 1)) {
+            pool_count_alloc(pool);
+            return pool_link(pool, index);
+        }
+    }
+}
+
+RING_INLINE void pool_free(pool_t *pool, void *block){
+    uint32_t index = ((uint8_t *)block - pool->mem) / pool->block_size;
+    uint32_t head, used;
+    do {
+        head = pool->head;
+        *pool_link(pool, index) = head & POOL_LINK_MASK;
+        RING_DMB;
+    } while (!ring_cas(&pool->head, head, ((head + POOL_TAG_STEP) & ~POOL_LINK_MASK) | (index + 1)));
+    do {
+        used = pool->used;
+    } while (!ring_cas(&pool->used, used, used - 1));
+}
+
+RING_INLINE uint8_t pool_owns(pool_t *pool, const void *block){
+    const uint8_t *ptr = block;
+    return ptr >= pool->mem && ptr < pool->mem + pool->count * pool->block_size &&
+           (uint32_t)(ptr - pool->mem) % pool->block_size == 0;
+}
+
+RING_INLINE uint32_t pool_used(pool_t *pool){
+    return pool->used;
+}
+
+RING_INLINE uint32_t pool_high_water(pool_t *pool){
+    return pool->high_water;
+}
+
+RING_INLINE uint32_t pool_exhausted(pool_t *pool){
+    return pool->exhausted;
+}
+
+#endif
@@ -0,0 +1,155 @@
+/**
+ * @file retained.h
+ * @brief Header only retained RAM block that survives warm resets
+ *
+ * The block lives in `.noinit`, so startup never zeroes it. A magic word and a
+ * CRC over the rest of the block tell a warm reset (contents kept) from a power
+ * on or a corrupted block (contents cleared).
+ *
+ * Usage:
+ *  #define BAD_RCC_IMPLEMENTATION
+ *  #define BAD_RETAINED_IMPLEMENTATION
+ *  #include "retained.h"
+ *
+ *  // CRC clock (RCC_AHB1_CRCEN) has to be on
+ *  if (!retained_init()) {
+ *      // cold boot, block was cleared
+ *  }
+ *  if (retained.block.crash_count) {
+ *      // retained.block.last_fault_pc / last_fault_cfsr of the last fault
+ *  }
+ *  retained.block.user[0]++;
+ *  retained_commit(); // after every change
+ *
+ *  // fault handler, before the reset (crash.h does this for you)
+ *  retained_record_fault(stack[6], SCB->CFSR);
+ *
+ * Notes:
+ *  - `RETAINED_USER_WORDS` (default 8) sets the size of the free user area,
+ *    `RETAINED_CRASH_STACK_WORDS` (default 32) the stack kept by crash.h.
+ *  - The CRC does not catch a layout change between firmware versions, bump
+ *    `RETAINED_MAGIC` whenever the struct changes.
+ *  - retained_record_fault is safe from fault context, it clocks the CRC itself
+ *    and starts from a cleared block when the current one isn't valid.
+ */
+
+#pragma once
+#ifndef BAD_RETAINED_H
+#define BAD_RETAINED_H
+
+#include "badhal.h"
+
+#ifndef RETAINED_USER_WORDS
+#define RETAINED_USER_WORDS (8)
+#endif
+
+#ifndef RETAINED_CRASH_STACK_WORDS
+#define RETAINED_CRASH_STACK_WORDS (32)
+#endif
+
+#define RETAINED_MAGIC (0xBADC0DE2UL)
+
+//Snapshot of the last hardfault, filled by crash.h
+typedef struct{
+    uint32_t frame[8];      //r0 r1 r2 r3 r12 lr pc xpsr
+    uint32_t exc_return;
+    uint32_t ipsr;          //exception that took the snapshot, 3 = hardfault
+    uint32_t sp;            //address of the frame
+    uint32_t cfsr;
+    uint32_t hfsr;
+    uint32_t mmfar;
+    uint32_t bfar;
+    uint32_t afsr;
+    uint32_t dfsr;
+    uint32_t stack_words;
+    uint32_t stack[RETAINED_CRASH_STACK_WORDS]; //the faulting code's stack, above the frame
+}retained_crash_t;
+
+typedef struct{
+    uint32_t boot_count;
+    uint32_t reset_cause;   //RCC_reset_cause_t of the current boot
+    uint32_t crash_count;
+    uint32_t last_fault_pc;
+    uint32_t last_fault_cfsr;
+    uint32_t crash_pending; //crash holds a snapshot nobody has dumped yet
+    retained_crash_t crash;
+    uint32_t user[RETAINED_USER_WORDS];
+}retained_block_t;
+
+typedef struct{
+    uint32_t magic;
+    uint32_t crc;
+    retained_block_t block;
+}retained_t;
+
+#define RETAINED_BLOCK_WORDS (sizeof(retained_block_t) / sizeof(uint32_t))
+
+extern retained_t retained;
+
+extern uint8_t retained_init(void);
+extern void retained_commit(void);
+extern void retained_record_fault(uint32_t pc, uint32_t cfsr);
+extern RCC_reset_cause_t retained_reset_cause(void);
+extern const char *retained_reset_cause_name(RCC_reset_cause_t cause);
+
+#ifdef BAD_RETAINED_IMPLEMENTATION
+
+retained_t retained ATTR_NOINIT;
+
+extern void retained_commit(void){
+    retained.magic = RETAINED_MAGIC;
+    retained.crc = crc_calculate((const uint32_t *)&retained.block, RETAINED_BLOCK_WORDS);
+}
+
+static uint8_t retained_validate(void){
+    uint8_t valid = retained.magic == RETAINED_MAGIC &&
+        retained.crc == crc_calculate((const uint32_t *)&retained.block, RETAINED_BLOCK_WORDS);
+
+    if (!valid) {
+        uint32_t *words = (uint32_t *)&retained.block;
+        for (uint32_t i = 0; i < RETAINED_BLOCK_WORDS; i++) {
+            words[i] = 0;
+        }
+    }
+    return valid;
+}
+
+//Returns 1 if the block survived the reset, 0 if it had to be cleared
+extern uint8_t retained_init(void){
+    uint8_t valid = retained_validate();
+    retained.block.boot_count++;
+    retained.block.reset_cause = rcc_reset_cause();
+    retained_commit();
+    return valid;
+}
+
+//Fault context, no rcc_periph_enable (PRIMASK juggling, refcounts), the reset follows anyway
+extern void retained_record_fault(uint32_t pc, uint32_t cfsr){
+    RCC->AHB1ENR |= RCC_AHB1_CRCEN;
+    (void)RCC->AHB1ENR;
+    retained_validate();
+    retained.block.crash_count++;
+    retained.block.last_fault_pc = pc;
+    retained.block.last_fault_cfsr = cfsr;
+    retained_commit();
+}
+
+extern RCC_reset_cause_t retained_reset_cause(void){
+    return retained.block.reset_cause;
+}
+
+//Most specific cause first, POR also sets PIN and BOR
+extern const char *retained_reset_cause_name(RCC_reset_cause_t cause){
+    if (cause & RCC_RESET_LOW_POWER) return "LOW POWER";
+    if (cause & RCC_RESET_WWDG) return "WWDG";
+    if (cause & RCC_RESET_IWDG) return "IWDG";
+    if (cause & RCC_RESET_SOFTWARE) return "SOFTWARE";
+    if (cause & RCC_RESET_POR) return "POWER ON";
+    if (cause & RCC_RESET_BOR) return "BROWN OUT";
+    if (cause & RCC_RESET_PIN) return "PIN";
+    return "UNKNOWN";
+}
+
+#endif
+
+#endif
@@ -0,0 +1,320 @@
+/**
+ * @file ring.h
+ * @brief Header only lock-free ring buffers for ISR to main handoff
+ *
+ * Two flavours, both power of two sized with free running 32 bit indices:
+ *  - `ring_t`     byte stream, single producer single consumer. Bulk copies
+ *                 and contiguous spans that can be handed to a DMA stream.
+ *  - `ring_msg_t` fixed size message slots, any number of producers (isrs at
+ *                 any priority and main) and one consumer. Slots are claimed
+ *                 with LDREX/STREX and published through a per slot sequence,
+ *                 a preempted producer never blocks a higher priority one.
+ *
+ * Usage:
+ *  #include "ring.h"
+ *
+ *  RING_DEFINE(uart_rx, 256);
+ *  // isr
+ *  ring_push(&uart_rx, byte);
+ *  // main
+ *  uint8_t c;
+ *  while (ring_pop(&uart_rx, &c)) { ... }
+ *
+ *  // DMA out of the ring, commit on transfer complete
+ *  uint8_t *span;
+ *  uint32_t len = ring_read_span(&uart_tx, &span);
+ *  ...
+ *  ring_read_commit(&uart_tx, len);
+ *
+ *  RING_MSG_DEFINE(events, sizeof(event_t), 16);
+ *  ring_msg_push(&events, &event, sizeof(event));          // any context
+ *  while (ring_msg_pop(&events, &event, sizeof(event))) {} // one consumer
+ *
+ * Notes:
+ *  - Without `__arm__` (host builds) the indices are C11 atomics and the
+ *    barriers are fences, tests/host/ring_test.c runs the rings on threads.
+ *  - Spans never wrap, a span ending at the buffer end can be shorter than
+ *    ring_count/ring_free, call again after committing.
+ *  - RING_DEFINE buffers are 16 byte aligned so spans from the start can be
+ *    used with burst DMA.
+ */
+
+#pragma once
+#ifndef BAD_RING_H
+#define BAD_RING_H
+
+#include <stdint.h>
+
+#ifdef __arm__
+#include "badhal.h"
+typedef volatile uint32_t ring_index_t;
+#define RING_DMB DMB
+#define RING_INLINE ALWAYS_STATIC
+
+//LDREX/STREX compare and swap, exception entry and return clear the monitor so an
+//isr touching the same word in between makes the STREX fail and the loop retry
+RING_INLINE uint8_t ring_cas(ring_index_t *ptr, uint32_t expected, uint32_t desired){
+    uint32_t value, fail;
+    do {
+        __asm volatile("ldrex %0, [%1]" : "=r"(value) : "r"(ptr) : "memory");
+        if (value != expected) {
+            __asm volatile("clrex" : : : "memory");
+            return 0;
+        }
+        __asm volatile("strex %0, %2, [%1]" : "=&r"(fail) : "r"(ptr), "r"(desired) : "memory");
+    } while (fail);
+    return 1;
+}
+
+RING_INLINE void ring_atomic_inc(ring_index_t *ptr){
+    uint32_t value, fail;
+    do {
+        __asm volatile("ldrex %0, [%1]" : "=r"(value) : "r"(ptr) : "memory");
+        value++;
+        __asm volatile("strex %0, %2, [%1]" : "=&r"(fail) : "r"(ptr), "r"(value) : "memory");
+    } while (fail);
+}
+
+#else
+#include <stdatomic.h>
+typedef _Atomic uint32_t ring_index_t;
+#define RING_DMB atomic_thread_fence(memory_order_seq_cst)
+#define RING_INLINE static inline
+
+static inline uint8_t ring_cas(ring_index_t *ptr, uint32_t expected, uint32_t desired){
+    return atomic_compare_exchange_strong(ptr, &expected, desired);
+}
+
+static inline void ring_atomic_inc(ring_index_t *ptr){
+    atomic_fetch_add(ptr, 1);
+}
+#endif
+
+//no libc, slots are small and spans go to DMA, a byte loop is enough
+RING_INLINE void ring_copy(uint8_t *dst, const uint8_t *src, uint32_t len){
+    while (len--) {
+        *dst++ = *src++;
+    }
+}
+
+#define RING_IS_POW2(x) ((x) != 0 && ((x) & ((x) - 1)) == 0)
+
+//Byte ring
+typedef struct{
+    uint8_t *buf;
+    uint32_t size;      //power of two
+    ring_index_t head;  //written by the producer only
+    ring_index_t tail;  //written by the consumer only
+}ring_t;
+
+#define RING_DEFINE(name, bytes)                                                \
+    _Static_assert(RING_IS_POW2(bytes), #name " size has to be a power of two"); \
+    static uint8_t name##_buf[bytes] __attribute__((aligned(16)));              \
+    ring_t name = {name##_buf, (bytes), 0, 0}
+
+RING_INLINE void ring_init(ring_t *ring, uint8_t *buf, uint32_t size){
+    ring->buf = buf;
+    ring->size = size;
+    ring->head = 0;
+    ring->tail = 0;
+}
+
+RING_INLINE uint32_t ring_count(ring_t *ring){
+    return ring->head - ring->tail;
+}
+
+RING_INLINE uint32_t ring_free(ring_t *ring){
+    return ring->size - (ring->head - ring->tail);
+}
+
+//Producer side
+RING_INLINE uint8_t ring_push(ring_t *ring, uint8_t byte){
+    uint32_t head = ring->head;
+    if (head - ring->tail == ring->size) {
+        return 0;
+    }
+    ring->buf[head & (ring->size - 1)] = byte;
+    RING_DMB;
+    ring->head = head + 1;
+    return 1;
+}
+
+//Free space from head up to the buffer end or the tail, whichever is closer
+RING_INLINE uint32_t ring_write_span(ring_t *ring, uint8_t **span){
+    uint32_t head = ring->head;
+    uint32_t free = ring->size - (head - ring->tail);
+    uint32_t offset = head & (ring->size - 1);
+    uint32_t to_end = ring->size - offset;
+    *span = &ring->buf[offset];
+    return free < to_end ? free : to_end;
+}
+
+RING_INLINE void ring_write_commit(ring_t *ring, uint32_t bytes){
+    RING_DMB;
+    ring->head = ring->head + bytes;
+}
+
+//Copies as much as fits, returns the number of bytes taken
+RING_INLINE uint32_t ring_write(ring_t *ring, const uint8_t *data, uint32_t len){
+    uint32_t done = 0;
+    while (done < len) {
+        uint8_t *span;
+        uint32_t chunk = ring_write_span(ring, &span);
+        if (!chunk) {
+            break;
+        }
+        if (chunk > len - done) {
+            chunk = len - done;
+        }
+        ring_copy(span, data + done, chunk);
+        ring_write_commit(ring, chunk);
+        done += chunk;
+    }
+    return done;
+}
+
+//Consumer side
+RING_INLINE uint8_t ring_pop(ring_t *ring, uint8_t *byte){
+    uint32_t tail = ring->tail;
+    if (tail == ring->head) {
+        return 0;
+    }
+    RING_DMB;
+    *byte = ring->buf[tail & (ring->size - 1)];
+    RING_DMB;
+    ring->tail = tail + 1;
+    return 1;
+}
+
+//Data from tail up to the buffer end or the head, whichever is closer
+RING_INLINE uint32_t ring_read_span(ring_t *ring, uint8_t **span){
+    uint32_t tail = ring->tail;
+    uint32_t used = ring->head - tail;
+    uint32_t offset = tail & (ring->size - 1);
+    uint32_t to_end = ring->size - offset;
+    RING_DMB;
+    *span = &ring->buf[offset];
+    return used < to_end ? used : to_end;
+}
+
+RING_INLINE void ring_read_commit(ring_t *ring, uint32_t bytes){
+    RING_DMB;
+    ring->tail = ring->tail + bytes;
+}
+
+RING_INLINE uint32_t ring_read(ring_t *ring, uint8_t *data, uint32_t len){
+    uint32_t done = 0;
+    while (done < len) {
+        uint8_t *span;
+        uint32_t chunk = ring_read_span(ring, &span);
+        if (!chunk) {
+            break;
+        }
+        if (chunk > len - done) {
+            chunk = len - done;
+        }
+        ring_copy(data + done, span, chunk);
+        ring_read_commit(ring, chunk);
+        done += chunk;
+    }
+    return done;
+}
+
+//Message ring
+//seq[i] + i is the position slot i waits for: == pos free for a producer at pos,
+//== pos + 1 published for the consumer at pos. Stored relative to i so a zeroed
+//ring is an empty one and RING_MSG_DEFINE can live in .bss.
+typedef struct{
+    uint8_t *slots;
+    ring_index_t *seq;
+    uint32_t count;         //power of two
+    uint32_t stride;        //slot size rounded up to a word
+    ring_index_t head;      //claimed by producers
+    ring_index_t tail;      //consumer
+    ring_index_t dropped;   //pushes that found the ring full
+}ring_msg_t;
+
+#define RING_MSG_STRIDE(size) (((size) + 3U) & ~3U)
+
+#define RING_MSG_DEFINE(name, size, slots)                                          \
+    _Static_assert(RING_IS_POW2(slots), #name " slot count has to be a power of two"); \
+    static uint8_t name##_slots[(slots) * RING_MSG_STRIDE(size)] __attribute__((aligned(4))); \
+    static ring_index_t name##_seq[slots];                                          \
+    ring_msg_t name = {name##_slots, name##_seq, (slots), RING_MSG_STRIDE(size), 0, 0, 0}
+
+//Reserves the slot for the next position, 0 when full. Fill it then ring_msg_publish.
+RING_INLINE void *ring_msg_claim(ring_msg_t *ring, uint32_t *pos){
+    uint32_t mask = ring->count - 1;
+    uint32_t claim = ring->head;
+    while (1) {
+        uint32_t slot = claim & mask;
+        int32_t diff = (int32_t)(ring->seq[slot] + slot - claim);
+        if (diff == 0) {
+            if (ring_cas(&ring->head, claim, claim + 1)) {
+                *pos = claim;
+                return &ring->slots[slot * ring->stride];
+            }
+        } else if (diff < 0) {
+            ring_atomic_inc(&ring->dropped);
+            return 0;
+        }
+        claim = ring->head;
+    }
+}
+
+RING_INLINE void ring_msg_publish(ring_msg_t *ring, uint32_t pos){
+    uint32_t slot = pos & (ring->count - 1);
+    RING_DMB;
+    ring->seq[slot] = pos + 1 - slot;
+}
+
+//0 when full, or without touching the ring when size doesn't fit a slot
+RING_INLINE uint8_t ring_msg_push(ring_msg_t *ring, const void *msg, uint32_t size){
+    uint32_t pos;
+    if (size > ring->stride) {
+        return 0;
+    }
+    void *slot = ring_msg_claim(ring, &pos);
+    if (!slot) {
+        return 0;
+    }
+    ring_copy(slot, msg, size);
+    ring_msg_publish(ring, pos);
+    return 1;
+}
+
+//Oldest published slot, 0 when empty or while its producer is still filling it
+RING_INLINE void *ring_msg_peek(ring_msg_t *ring){
+    uint32_t pos = ring->tail;
+    uint32_t slot = pos & (ring->count - 1);
+    if (ring->seq[slot] + slot != pos + 1) {
+        return 0;
+    }
+    RING_DMB;
+    return &ring->slots[slot * ring->stride];
+}
+
+RING_INLINE void ring_msg_release(ring_msg_t *ring){
+    uint32_t pos = ring->tail;
+    uint32_t slot = pos & (ring->count - 1);
+    RING_DMB;
+    ring->seq[slot] = pos + ring->count - slot;
+    ring->tail = pos + 1;
+}
+
+//Copies at most a slot, a larger size leaves the rest of msg alone
+RING_INLINE uint8_t ring_msg_pop(ring_msg_t *ring, void *msg, uint32_t size){
+    void *slot = ring_msg_peek(ring);
+    if (!slot) {
+        return 0;
+    }
+    ring_copy(msg, slot, size < ring->stride ? size : ring->stride);
+    ring_msg_release(ring);
+    return 1;
+}
+
+RING_INLINE uint32_t ring_msg_dropped(ring_msg_t *ring){
+    return ring->dropped;
+}
+
+#endif
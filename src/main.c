@@ -11,6 +11,7 @@
 #define BAD_FLASH_IMPLEMENTATION
 #define BAD_GPIO_IMPLEMENTATION
 #define BAD_USART_IMPLEMENTATION
+#define BAD_PWR_IMPLEMENTATION
 
 #define BAD_HARDFAULT_ISR_IMPLEMENTATION
 #define BAD_HARDFAULT_USE_UART
@@ -52,35 +53,59 @@
 #define EXTI_PORT   (SYSCFG_PBx)
 #define EXTI_PIN    (1)
 
-uint16_t random_bitmap[240*240];
+uint16_t random_bitmap[240*240] ATTR_NOINIT; //fully rewritten every frame, no need to zero it at boot
+ILI9341_FB_STATIC_CHECK(240, 240);
 
 #define BADHAL_FLASH_LATENCY (FLASH_LATENCY_3ws)
 
-#define BAD_GB_AHB1_PERIPEHRALS    (RCC_AHB1_GPIOA|RCC_AHB1_DMA2|RCC_AHB1_GPIOB)
-#define BAD_GB_APB2_PERIPHERALS    (RCC_APB2_USART1|RCC_APB2_SPI1|RCC_APB2_SYSCFGEN)
+//SPI1 and DMA2 are clocked by ili9341_spi_init
+#define BAD_GB_AHB1_PERIPEHRALS    (RCC_AHB1_GPIOA|RCC_AHB1_GPIOB)
+#define BAD_GB_APB2_PERIPHERALS    (RCC_APB2_USART1)
+
+//Display DMA completion must never wait on anything else, every irq not listed
+//here runs at NVIC_PRIO_DEFAULT (15), below all of them
+static const NVIC_prio_entry_t priority_plan[] = {
+    {NVIC_DMA2_STREAM2_INTR,    NVIC_PRIO1},
+    {NVIC_USART1_INTR,          NVIC_PRIO2},
+    {NVIC_EXTI1_INTR,           NVIC_PRIO4},
+};
 
 static inline void __main_clock_setup(){
     flash_acceleration_setup(BADHAL_FLASH_LATENCY, FLASH_DCACHE_ENABLE, FLASH_ICACHE_ENABLE);
     rcc_sysclock_setup();
 }
 
+//clocks come up from isr_reset so .data/.bss init already runs at 100mhz
+void startup_early_init(){
+    __main_clock_setup();
+}
+
+
+static const GPIO_port_config_t uart_port = IO_PORT_CONFIG(
+    IO_PIN(UART1_TX_PIN, MODER_af, UART1_TX_AF, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull),
+    IO_PIN(UART1_RX_PIN, MODER_af, UART1_RX_AF, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull)
+);
+
+//SPI and the ILI9341 control pins share GPIOB
+static const GPIO_port_config_t spi_port = IO_PORT_CONFIG(
+    IO_PIN(SPI_SCK_PIN, MODER_af, SPI_SCK_AF, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull),
+    IO_PIN(SPI_MISO_PIN, MODER_af, SPI_MISO_AF, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull),
+    IO_PIN(SPI_MOSI_PIN, MODER_af, SPI_MOSI_AF, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull),
+    IO_PIN(ILI9341_CS, MODER_output, 0, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull),
+    IO_PIN(ILI9431_RESET, MODER_output, 0, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull),
+    IO_PIN(ILI9341_DC, MODER_output, 0, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull)
+);
 
 static inline void __periph_setup(){
     rcc_set_ahb1_clocking(BAD_GB_AHB1_PERIPEHRALS);
-    io_setup_pin(UART_GPIO_PORT, UART1_TX_PIN, MODER_af, UART1_TX_AF, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull);
-    io_setup_pin(UART_GPIO_PORT, UART1_RX_PIN, MODER_af, UART1_RX_AF, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull);
-    //Enable UART clocking
-    io_setup_pin(SPI_GPIO_PORT, SPI_SCK_PIN, MODER_af, SPI_SCK_AF, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull);
-    io_setup_pin(SPI_GPIO_PORT, SPI_MISO_PIN, MODER_af, SPI_MISO_AF, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull);
-    io_setup_pin(SPI_GPIO_PORT, SPI_MOSI_PIN, MODER_af, SPI_MOSI_AF, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull);
-    io_setup_pin(ILI9431_GPIO_PORT, ILI9341_CS, MODER_output, 0, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull);
-    io_setup_pin(ILI9431_GPIO_PORT, ILI9431_RESET, MODER_output, 0, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull);
-    io_setup_pin(ILI9431_GPIO_PORT, ILI9341_DC, MODER_output, 0, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull);
+    io_setup_port(UART_GPIO_PORT, &uart_port);
+    io_setup_port(SPI_GPIO_PORT, &spi_port);
     //io_setup_pin(EXTI1_GPIO_PORT, EXTI1_PIN, MODER_reset_input, 0, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull);
     rcc_set_apb2_clocking(BAD_GB_APB2_PERIPHERALS);
+    rcc_gate_sleep_clocks();
 }
 
-static __attribute__((noinline))void __gen_bitmap(uint16_t frame){
+static APP_HOT __attribute__((noinline)) void __gen_bitmap(uint16_t frame){
     for (uint16_t y = 0; y < 240; y++) {
         for (uint16_t x = 0; x < 240; x++) {
             uint16_t r = ((x+frame) >> 3) & 0x1F;         
@@ -93,11 +118,12 @@ static __attribute__((noinline))void __gen_bitmap(uint16_t frame){
 
 int __attribute__((noinline)) main(){
     __DISABLE_INTERUPTS;
-    __main_clock_setup();
     __periph_setup();
+    nvic_apply_priorities(priority_plan, sizeof(priority_plan) / sizeof(priority_plan[0]));
    
     ili9341_spi_init();
-   
+    dwt_cycle_counter_enable(); //idle_stats
+    idle_stats_reset();
 
     
     __ENABLE_INTERUPTS;
@@ -107,7 +133,7 @@ int __attribute__((noinline)) main(){
     while(1){
         __gen_bitmap(frame);
         frame++;
-        while(!ili9341_poll_dma_ready());
+        ili9341_wait_dma_ready();
         ili9341_fb_dma_fill_centered(random_bitmap, 240, 240);
     
         
@@ -13,12 +13,7 @@ extern unsigned int __rramfunc;
 extern unsigned int __ramfunc;
 extern unsigned int __eramfunc;
 
-extern unsigned int __rramfunc;
-extern unsigned int __ramfunc;
-extern unsigned int __eramfunc;
-
-extern unsigned int __ram_ivt;
-extern unsigned int __eram_ivt;
+extern unsigned int __eram_ivt; //__ram_ivt comes from badhal.h
 
 typedef void (*constructor_ptr)();
 
@@ -32,6 +27,9 @@ void default_isr(){
     while(1);
 }
 WEAK_ISR(isr_hardfault);
+WEAK_ISR(isr_memmanage);
+WEAK_ISR(isr_busfault);
+WEAK_ISR(isr_usagefault);
 WEAK_ISR(wwdg_isr);
 WEAK_ISR(pvd_isr);
 WEAK_ISR(tamp_stamp_isr);
@@ -93,27 +91,52 @@ WEAK_ISR(pendsv_isr);
 WEAK_ISR(systick_isr);
 WEAK_ISR(svc_isr);
 
-static inline void data_init(){ 
-    unsigned int *src = &__rdata;
-    unsigned int *dest = &__data;
-    while (dest<&__edata) {
+// 8 words per ldm/stm pair, r7 is left alone since it is the frame pointer at -O0
+static inline void copy_words(unsigned int *dest, const unsigned int *src, const unsigned int *end){
+    while (end - dest >= 8) {
+        __asm volatile(
+            "ldmia %0!, {r2-r6,r8,r9,r12}   \n"
+            "stmia %1!, {r2-r6,r8,r9,r12}   \n"
+            : "+r"(src), "+r"(dest)
+            :
+            : "r2", "r3", "r4", "r5", "r6", "r8", "r9", "r12", "memory"
+        );
+    }
+    while (dest < end) {
         *dest++ = *src++;
     }
 }
 
-static inline void bss_init(){
-    unsigned int *src = &__bss;
-    while (src<&__ebss) {
-        *src++ = 0; 
+static inline void zero_words(unsigned int *dest, const unsigned int *end){
+    while (end - dest >= 8) {
+        __asm volatile(
+            "movs r2, #0                \n"
+            "movs r3, #0                \n"
+            "movs r4, #0                \n"
+            "movs r5, #0                \n"
+            "stmia %0!, {r2-r5}         \n"
+            "stmia %0!, {r2-r5}         \n"
+            : "+r"(dest)
+            :
+            : "r2", "r3", "r4", "r5", "cc", "memory"
+        );
+    }
+    while (dest < end) {
+        *dest++ = 0;
     }
 }
 
+static inline void data_init(){ 
+    copy_words(&__data, &__rdata, &__edata);
+}
+
+//.noinit is NOLOAD and placed after .bss, it is never touched here
+static inline void bss_init(){
+    zero_words(&__bss, &__ebss);
+}
+
 static inline void ramfunc_init(){
-    unsigned int *src = &__rramfunc;
-    unsigned int *dest = &__ramfunc;
-    while (dest<&__eramfunc) {
-        *dest++ = *src++;
-    }
+    copy_words(&__ramfunc, &__rramfunc, &__eramfunc);
 }
 
 static inline void constructors_init(){
@@ -126,13 +149,61 @@ static inline void constructors_init(){
 
 static inline void copy_ivt_to_ram();
 
+// Runs before .data/.bss exist, so no globals. Override it to raise flash
+// latency and switch to the PLL before the copies instead of doing them at
+// 16mhz HSI, main must not set the clocks up again afterwards.
+DEFAULT_USER_ISR(startup_early_init){
+}
+WEAK_USER_ISR(startup_early_init);
+
+// Core cycles can't compare the two paths, startup_early_init changes what a
+// cycle is. Each phase is counted on its own and converted with the clock it
+// ran at: the hook at the 16mhz reset clock (the PLL switch is its last step),
+// the copies at whatever SWS reports after it. startup_us is the comparable one.
+#ifdef BAD_STARTUP_MEASURE
+//RCC registers are only declared with BAD_RCC_IMPLEMENTATION, which belongs to main
+#define STARTUP_RCC_CFGR    (*(__IO uint32_t *)0x40023808UL)
+#define STARTUP_SWS_PLL     (0x2 << 2)
+#define STARTUP_SWS_MASK    (0x3 << 2)
+uint32_t startup_early_cycles;  //reset to the end of startup_early_init, at FALLBACK_CLOCK_SPEED
+uint32_t startup_init_cycles;   //copies, zeroing and constructors, at startup_init_hz
+uint32_t startup_init_hz;
+uint32_t startup_us;            //reset to main
+#endif
+
+// Everything is built with -mfloat-abi=hard, CP10/CP11 have to be on before any
+// C code that might touch s0-s31. Lazy stacking keeps the basic 8 word frame
+// until an isr actually executes a float instruction. -DBAD_STARTUP_NO_FPU for
+// soft float builds.
+static inline void fpu_init(){
+#ifndef BAD_STARTUP_NO_FPU
+    SCB_set_fpu_permission_level(SCB_FPU_FULL_ACCESS);
+    fpu_setup(FPU_FEATURE_ENABLE_AUTO_STACKING | FPU_FEATURE_ENABLE_LAZY_STACKING);
+#endif
+}
 
 void __attribute__((noreturn)) isr_reset(){
+#ifdef BAD_STARTUP_MEASURE
+    dwt_cycle_counter_enable();
+#endif
+    fpu_init();
+    startup_early_init();
+#ifdef BAD_STARTUP_MEASURE
+    //locals, the globals don't exist before the copies
+    uint32_t early = dwt_cycles();
+    uint32_t hz = (STARTUP_RCC_CFGR & STARTUP_SWS_MASK) == STARTUP_SWS_PLL ? CLOCK_SPEED : FALLBACK_CLOCK_SPEED;
+#endif
     data_init();
     bss_init();
     ramfunc_init();
     copy_ivt_to_ram();
     constructors_init();
+#ifdef BAD_STARTUP_MEASURE
+    startup_init_cycles = dwt_cycles() - early;
+    startup_early_cycles = early;
+    startup_init_hz = hz;
+    startup_us = early / (FALLBACK_CLOCK_SPEED / 1000000UL) + startup_init_cycles / (hz / 1000000UL);
+#endif
     main();
     while(1);
 };
@@ -144,9 +215,9 @@ const isr_addr_t ivt_table[IVT_SIZE] __attribute__((used,section(".ivt")))={
     isr_reset,
     0, //NMI
     isr_hardfault,
-    isr_hardfault,
-    isr_hardfault,
-    isr_hardfault,
+    isr_memmanage,  //only taken once enabled in SHCSR, see SCB_enable_fault_handlers
+    isr_busfault,
+    isr_usagefault,
     0,
     0,
     0,
@@ -244,10 +315,10 @@ const isr_addr_t ivt_table[IVT_SIZE] __attribute__((used,section(".ivt")))={
     spi5_isr
 
 };
+//handlers are installed into the copy with ivt_install
 static inline void copy_ivt_to_ram(){
-    unsigned int *dest = &__ram_ivt;
-    unsigned int *src = (unsigned int*)ivt_table; 
-    while (dest<&__eram_ivt) {
-        *dest++ = *src++; 
-    }
+    copy_words((unsigned int*)__ram_ivt, (const unsigned int*)ivt_table, &__eram_ivt);
+    SCB->VTOR = (uint32_t)__ram_ivt;
+    DSB;
+    ISB;
 }
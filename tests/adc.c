@@ -0,0 +1,109 @@
+    // HSE  = 25
+    // PLLM = 25
+    // PLLN = 400
+    // PLLQ = 10
+    // PLLP = 4
+    // Sysclock = 100
+
+#define BAD_PLLM (25)
+#define BAD_PLLN (400)
+#define BAD_PLLQ (10)
+#define BAD_PLLP (PLLP4)
+
+#define BAD_AHB_PRE     (HPRE_DIV_1)
+#define BAD_APB1_PRE    (PPRE_DIV_2)
+#define BAD_APB2_PRE    (PPRE_DIV_1)
+
+#define BAD_RCC_IMPLEMENTATION
+#define BAD_GPIO_IMPLEMENTATION
+#define BAD_TIMER_IMPLEMENTATION
+#define BAD_DMA_IMPLEMENTATION
+#define BAD_ADC_IMPLEMENTATION
+#define BAD_FLASH_IMPLEMENTATION
+
+#define BAD_DMA_DMA2_STREAM0_ISR_IMPLEMENTATION
+#define BAD_DMA_DMA2_STREAM0_USE_HT
+#define BAD_DMA_DMA2_STREAM0_USE_TC
+#include "badhal.h"
+
+#define ADC_GPIO_PORT           (GPIOA)
+#define ADC_TEST_CHANNELS       (4) // PA0-PA3 -> IN0-IN3
+#define ADC_TEST_FRAMES         (16)// frames per half, 16 = 4^2 -> 2 extra bits
+#define ADC_TEST_OVERSAMPLE     (2)
+#define ADC_TEST_BUFF_LEN       (2 * ADC_TEST_FRAMES * ADC_TEST_CHANNELS)
+
+#define BADHAL_FLASH_LATENCY (FLASH_LATENCY_3ws)
+
+#define BAD_ADC_TEST_AHB1_PERIPEHRALS    (RCC_AHB1_GPIOA|RCC_AHB1_DMA2)
+#define BAD_ADC_TEST_APB1_PERIPHERALS    (RCC_APB1_TIM3)
+#define BAD_ADC_TEST_APB2_PERIPHERALS    (RCC_APB2_ADC1)
+
+//TIM3 runs off 2*APB1 = 100mhz, 1mhz tick, 1khz trigger
+#define BAD_ADC_TEST_TIM_ARR    (999)
+#define BAD_ADC_TEST_TIM_PSC    (99)
+
+#define BAD_ADC_TEST_FEATURES   (ADC_FEATURE_SCAN|ADC_FEATURE_RES_12bit)
+
+static const uint8_t adc_sequence[ADC_TEST_CHANNELS] = {0, 1, 2, 3};
+
+uint16_t adc_samples[ADC_TEST_BUFF_LEN] __attribute__((aligned(4)));
+volatile uint16_t adc_result[ADC_TEST_CHANNELS]; // 14 bit oversampled
+volatile uint32_t adc_blocks;
+
+void dma2_stream0_ht(uint16_t offset){
+    UNUSED(offset);
+    adc_reduce_block(adc_samples, ADC_TEST_FRAMES, ADC_TEST_CHANNELS, ADC_TEST_OVERSAMPLE, (uint16_t *)adc_result);
+    adc_blocks++;
+}
+
+void dma2_stream0_tc(uint16_t offset){
+    UNUSED(offset);
+    adc_reduce_block(adc_samples + ADC_TEST_BUFF_LEN / 2, ADC_TEST_FRAMES, ADC_TEST_CHANNELS, ADC_TEST_OVERSAMPLE, (uint16_t *)adc_result);
+    adc_blocks++;
+}
+
+static inline void __main_clock_setup(){
+    flash_acceleration_setup(BADHAL_FLASH_LATENCY, FLASH_DCACHE_ENABLE, FLASH_ICACHE_ENABLE);
+    rcc_sysclock_setup();
+}
+
+static inline void __periph_setup(){
+    rcc_set_ahb1_clocking(BAD_ADC_TEST_AHB1_PERIPEHRALS);
+    rcc_set_apb1_clocking(BAD_ADC_TEST_APB1_PERIPHERALS);
+    rcc_set_apb2_clocking(BAD_ADC_TEST_APB2_PERIPHERALS);
+    for (uint8_t i = 0; i < ADC_TEST_CHANNELS; i++){
+        io_setup_pin(ADC_GPIO_PORT, i, MODER_analog, 0, OSPEEDR_low_speed, PUPDR_no_pull, OTYPR_push_pull);
+    }
+}
+
+static inline void __adc_setup(){
+    adc_set_prescaler(ADC_PRESCALER_div_4);
+    adc_setup(ADC1, BAD_ADC_TEST_FEATURES, 0, ADC_TRIGGER_TIM3_TRGO);
+    for (uint8_t i = 0; i < ADC_TEST_CHANNELS; i++){
+        adc_set_sample_time(ADC1, adc_sequence[i], ADC_SMP_84_CYCLES);
+    }
+    adc_set_sequence(ADC1, adc_sequence, ADC_TEST_CHANNELS);
+    adc_start_dma_circular(ADC1, adc_samples, ADC_TEST_BUFF_LEN);
+    nvic_enable_interrupt(NVIC_DMA2_STREAM0_INTR);
+}
+
+static inline void __timer_setup(){
+    basic_timer_setup(BTIM3, BAD_ADC_TEST_TIM_ARR, BAD_ADC_TEST_TIM_PSC, 0);
+    tim_set_trgo(BTIM3, BTIMER_TRGO_UPDATE);
+    tim_enable(BTIM3);
+}
+
+int main(){
+    __DISABLE_INTERUPTS;
+    __main_clock_setup();
+    __periph_setup();
+    __adc_setup();
+    __timer_setup();
+
+    __ENABLE_INTERUPTS;
+
+    while(1){
+
+    }
+    return 0;
+}
@@ -0,0 +1,149 @@
+// Generated by tools/image_convert.py from badge.png, don't edit
+// 160x80, 62 colors, 2059 bytes (RGB565 25600 bytes, 12.4x)
+#pragma once
+#ifndef BAD_IMAGE_BADGE_H
+#define BAD_IMAGE_BADGE_H
+
+#include "ili9341_image.h"
+
+static const uint16_t badge_palette[62] = {
+    0x0000,0x11EF,0x1A0F,0x1A2F,0x222F,0x2230,0x2250,0x2A70,0x2A90,0x2E4A,0x32B1,0x32D1,
+    0x3AD1,0x3AF1,0x3AF2,0x3B12,0x4312,0x4332,0x4B32,0x4B52,0x4B73,0x5373,0x5393,0x63F4,
+    0x6C15,0x6C35,0x7455,0x7476,0x7C76,0x7C96,0x84B6,0x84D7,0x84F7,0x8CF7,0x8D17,0x9538,
+    0x9D58,0x9D78,0xA599,0xA5B9,0xADD9,0xADDA,0xBE3B,0xBE5B,0xC67B,0xC69B,0xCE9B,0xD6FC,
+    0xD945,0xDF1D,0xDF3D,0xE73D,0xE75D,0xE75E,0xEF7E,0xF642,0xF79E,0xF7BE,0xF7BF,0xF7DF,
+    0xFFDF,0xFFFF,
+};
+
+static const uint8_t badge_data[1935] = {
+    0x8A,0x00,0xFF,0x38,0x89,0x38,0x92,0x00,0xFF,0x38,0x8F,0x38,0x8E,0x00,0xFF,0x38,
+    0x91,0x38,0x8B,0x00,0x85,0x38,0xFF,0x01,0x89,0x01,0x85,0x38,0x88,0x00,0x84,0x38,
+    0xFF,0x01,0x8D,0x01,0x84,0x38,0x86,0x00,0x83,0x38,0xFF,0x01,0x91,0x01,0x83,0x38,
+    0x85,0x00,0x82,0x38,0xFF,0x01,0x93,0x01,0x82,0x38,0x84,0x00,0x82,0x38,0xFF,0x01,
+    0x95,0x01,0x82,0x38,0x82,0x00,0x83,0x38,0xFF,0x01,0x95,0x01,0x83,0x38,0x01,0x00,
+    0x00,0x82,0x38,0xFF,0x01,0x97,0x01,0x82,0x38,0x01,0x00,0x00,0x82,0x38,0xFF,0x01,
+    0x97,0x01,0x82,0x38,0x00,0x00,0x82,0x38,0xFF,0x01,0x99,0x01,0x85,0x38,0xFF,0x01,
+    0x99,0x01,0x85,0x38,0xFF,0x01,0x99,0x01,0x85,0x38,0x9B,0x01,0x86,0x3D,0x03,0x39,
+    0x2F,0x26,0x12,0x88,0x01,0x00,0x0B,0x84,0x3D,0x00,0x0D,0x86,0x01,0x84,0x3D,0x05,
+    0x3C,0x38,0x33,0x2C,0x23,0x0E,0x86,0x01,0x83,0x3D,0x00,0x0C,0x84,0x01,0x00,0x2C,
+    0x82,0x3D,0x00,0x1A,0x85,0x01,0x00,0x0B,0x84,0x3D,0x00,0x0D,0x86,0x01,0x83,0x3D,
+    0x00,0x0C,0xA1,0x01,0x85,0x38,0x9B,0x01,0x8A,0x3D,0x00,0x20,0x87,0x01,0x00,0x22,
+    0x84,0x3D,0x00,0x23,0x86,0x01,0x8A,0x3D,0x01,0x2B,0x07,0x84,0x01,0x83,0x3D,0x00,
+    0x0C,0x84,0x01,0x00,0x2C,0x82,0x3D,0x00,0x1A,0x85,0x01,0x00,0x22,0x84,0x3D,0x00,
+    0x23,0x86,0x01,0x83,0x3D,0x00,0x0C,0xA1,0x01,0x85,0x38,0x9B,0x01,0x83,0x3D,0x03,
+    0x0C,0x01,0x02,0x17,0x83,0x3D,0x00,0x0D,0x86,0x01,0x00,0x33,0x84,0x3D,0x00,0x35,
+    0x86,0x01,0x83,0x3D,0x04,0x0C,0x01,0x06,0x16,0x2B,0x82,0x3D,0x01,0x36,0x0B,0x83,
+    0x01,0x83,0x3D,0x00,0x0C,0x84,0x01,0x00,0x2C,0x82,0x3D,0x00,0x1A,0x85,0x01,0x00,
+    0x33,0x84,0x3D,0x00,0x35,0x86,0x01,0x83,0x3D,0x00,0x0C,0xA1,0x01,0x85,0x38,0x9B,
+    0x01,0x83,0x3D,0x00,0x0C,0x82,0x01,0x00,0x2B,0x82,0x3D,0x00,0x1E,0x85,0x01,0x00,
+    0x15,0x82,0x3D,0x00,0x3C,0x82,0x3D,0x00,0x16,0x85,0x01,0x83,0x3D,0x00,0x0C,0x83,
+    0x01,0x00,0x24,0x82,0x3D,0x01,0x31,0x02,0x82,0x01,0x83,0x3D,0x00,0x0C,0x84,0x01,
+    0x00,0x2C,0x82,0x3D,0x00,0x1A,0x84,0x01,0x00,0x15,0x82,0x3D,0x00,0x3C,0x82,0x3D,
+    0x00,0x16,0x85,0x01,0x83,0x3D,0x00,0x0C,0xA1,0x01,0x85,0x38,0x9B,0x01,0x83,0x3D,
+    0x00,0x0C,0x82,0x01,0x00,0x26,0x82,0x3D,0x00,0x23,0x85,0x01,0x00,0x27,0x82,0x3D,
+    0x00,0x1D,0x82,0x3D,0x00,0x29,0x85,0x01,0x83,0x3D,0x00,0x0C,0x83,0x01,0x01,0x02,
+    0x32,0x82,0x3D,0x00,0x1B,0x82,0x01,0x83,0x3D,0x00,0x0C,0x84,0x01,0x00,0x2C,0x82,
+    0x3D,0x00,0x1A,0x84,0x01,0x00,0x27,0x82,0x3D,0x00,0x1D,0x82,0x3D,0x00,0x29,0x85,
+    0x01,0x83,0x3D,0x00,0x0C,0xA1,0x01,0x85,0x38,0x9B,0x01,0x83,0x3D,0x00,0x0C,0x82,
+    0x01,0x00,0x2A,0x82,0x3D,0x00,0x1C,0x84,0x01,0x0A,0x03,0x3A,0x3D,0x3D,0x34,0x01,
+    0x31,0x3D,0x3D,0x3B,0x05,0x84,0x01,0x83,0x3D,0x00,0x0C,0x84,0x01,0x00,0x1F,0x82,
+    0x3D,0x00,0x2D,0x82,0x01,0x83,0x3D,0x00,0x0C,0x84,0x01,0x00,0x2C,0x82,0x3D,0x00,
+    0x1A,0x83,0x01,0x0A,0x03,0x3A,0x3D,0x3D,0x34,0x01,0x31,0x3D,0x3D,0x3B,0x05,0x84,
+    0x01,0x83,0x3D,0x00,0x0C,0xA1,0x01,0x85,0x38,0x9B,0x01,0x83,0x3D,0x03,0x0C,0x01,
+    0x02,0x17,0x82,0x3D,0x01,0x39,0x07,0x84,0x01,0x00,0x19,0x82,0x3D,0x02,0x23,0x01,
+    0x22,0x82,0x3D,0x00,0x1A,0x84,0x01,0x83,0x3D,0x00,0x0C,0x84,0x01,0x00,0x16,0x82,
+    0x3D,0x00,0x3C,0x82,0x01,0x83,0x3D,0x00,0x0C,0x84,0x01,0x00,0x2C,0x82,0x3D,0x00,
+    0x1A,0x83,0x01,0x00,0x19,0x82,0x3D,0x02,0x23,0x01,0x22,0x82,0x3D,0x00,0x1A,0x84,
+    0x01,0x83,0x3D,0x00,0x0C,0xA1,0x01,0x85,0x38,0x9B,0x01,0x89,0x3D,0x01,0x31,0x11,
+    0x85,0x01,0x00,0x2C,0x82,0x3D,0x02,0x0F,0x01,0x0D,0x82,0x3D,0x00,0x2E,0x84,0x01,
+    0x83,0x3D,0x00,0x0C,0x84,0x01,0x00,0x0F,0x83,0x3D,0x02,0x06,0x01,0x01,0x8D,0x3D,
+    0x00,0x1A,0x83,0x01,0x00,0x2C,0x82,0x3D,0x02,0x0F,0x01,0x0D,0x82,0x3D,0x00,0x2E,
+    0x84,0x01,0x83,0x3D,0x00,0x0C,0xA1,0x01,0x85,0x38,0x9B,0x01,0x89,0x3D,0x02,0x3C,
+    0x26,0x02,0x83,0x01,0x00,0x08,0x82,0x3D,0x00,0x31,0x82,0x01,0x00,0x2F,0x82,0x3D,
+    0x00,0x0A,0x83,0x01,0x83,0x3D,0x00,0x0C,0x84,0x01,0x00,0x10,0x83,0x3D,0x02,0x06,
+    0x01,0x01,0x8D,0x3D,0x00,0x1A,0x82,0x01,0x00,0x08,0x82,0x3D,0x00,0x31,0x82,0x01,
+    0x00,0x2F,0x82,0x3D,0x00,0x0A,0x83,0x01,0x83,0x3D,0x00,0x0C,0xA1,0x01,0x85,0x38,
+    0x9B,0x01,0x83,0x3D,0x04,0x0C,0x01,0x01,0x0C,0x2B,0x82,0x3D,0x00,0x26,0x83,0x01,
+    0x00,0x1F,0x82,0x3D,0x00,0x1F,0x82,0x01,0x00,0x1F,0x82,0x3D,0x00,0x21,0x83,0x01,
+    0x83,0x3D,0x00,0x0C,0x84,0x01,0x00,0x16,0x82,0x3D,0x00,0x3C,0x82,0x01,0x83,0x3D,
+    0x00,0x0C,0x84,0x01,0x00,0x2C,0x82,0x3D,0x00,0x1A,0x82,0x01,0x00,0x1F,0x82,0x3D,
+    0x00,0x1F,0x82,0x01,0x00,0x1F,0x82,0x3D,0x00,0x21,0x83,0x01,0x83,0x3D,0x00,0x0C,
+    0xA1,0x01,0x85,0x38,0x9B,0x01,0x83,0x3D,0x00,0x0C,0x82,0x01,0x00,0x07,0x83,0x3D,
+    0x00,0x04,0x82,0x01,0x00,0x31,0x8A,0x3D,0x00,0x33,0x83,0x01,0x83,0x3D,0x00,0x0C,
+    0x84,0x01,0x00,0x21,0x82,0x3D,0x00,0x2D,0x82,0x01,0x83,0x3D,0x00,0x0C,0x84,0x01,
+    0x00,0x2C,0x82,0x3D,0x00,0x1A,0x82,0x01,0x00,0x31,0x8A,0x3D,0x00,0x33,0x83,0x01,
+    0x83,0x3D,0x00,0x0C,0xA1,0x01,0x85,0x38,0x9B,0x01,0x83,0x3D,0x00,0x0C,0x83,0x01,
+    0x00,0x3A,0x82,0x3D,0x03,0x0E,0x01,0x01,0x13,0x8C,0x3D,0x00,0x14,0x82,0x01,0x83,
+    0x3D,0x00,0x0C,0x83,0x01,0x01,0x02,0x33,0x82,0x3D,0x00,0x1B,0x82,0x01,0x83,0x3D,
+    0x00,0x0C,0x84,0x01,0x00,0x2C,0x82,0x3D,0x03,0x1A,0x01,0x01,0x13,0x8C,0x3D,0x00,
+    0x14,0x82,0x01,0x83,0x3D,0x00,0x0C,0xA1,0x01,0x85,0x38,0x9B,0x01,0x83,0x3D,0x00,
+    0x0C,0x82,0x01,0x00,0x07,0x83,0x3D,0x03,0x0A,0x01,0x01,0x26,0x82,0x3D,0x00,0x0B,
+    0x84,0x01,0x00,0x0A,0x82,0x3D,0x00,0x27,0x82,0x01,0x83,0x3D,0x00,0x0C,0x83,0x01,
+    0x00,0x25,0x82,0x3D,0x01,0x31,0x02,0x82,0x01,0x83,0x3D,0x00,0x0C,0x84,0x01,0x00,
+    0x2C,0x82,0x3D,0x03,0x1A,0x01,0x01,0x26,0x82,0x3D,0x00,0x0B,0x84,0x01,0x00,0x0A,
+    0x82,0x3D,0x00,0x27,0x82,0x01,0x83,0x3D,0x00,0x0C,0xA1,0x01,0x85,0x38,0x9B,0x01,
+    0x83,0x3D,0x04,0x0C,0x01,0x01,0x0C,0x2B,0x82,0x3D,0x07,0x2F,0x01,0x01,0x02,0x38,
+    0x3D,0x3D,0x35,0x86,0x01,0x06,0x33,0x3D,0x3D,0x3A,0x03,0x01,0x01,0x83,0x3D,0x04,
+    0x0C,0x01,0x06,0x16,0x2B,0x82,0x3D,0x01,0x36,0x0B,0x83,0x01,0x83,0x3D,0x00,0x0C,
+    0x84,0x01,0x00,0x2C,0x82,0x3D,0x06,0x1A,0x01,0x02,0x38,0x3D,0x3D,0x35,0x86,0x01,
+    0x06,0x33,0x3D,0x3D,0x3A,0x03,0x01,0x01,0x83,0x3D,0x00,0x0C,0xA1,0x01,0x85,0x38,
+    0x9B,0x01,0x8A,0x3D,0x04,0x36,0x10,0x01,0x01,0x17,0x82,0x3D,0x00,0x28,0x86,0x01,
+    0x00,0x27,0x82,0x3D,0x02,0x18,0x01,0x01,0x8A,0x3D,0x01,0x2B,0x07,0x84,0x01,0x83,
+    0x3D,0x00,0x0C,0x84,0x01,0x00,0x2C,0x82,0x3D,0x02,0x1A,0x01,0x17,0x82,0x3D,0x00,
+    0x28,0x86,0x01,0x00,0x27,0x82,0x3D,0x02,0x18,0x01,0x01,0x8A,0x3D,0x00,0x1C,0x9A,
+    0x01,0x85,0x38,0x9B,0x01,0x86,0x3D,0x04,0x3C,0x36,0x2C,0x1F,0x06,0x82,0x01,0x00,
+    0x2A,0x82,0x3D,0x00,0x1A,0x86,0x01,0x00,0x18,0x82,0x3D,0x02,0x2C,0x01,0x01,0x85,
+    0x3D,0x04,0x3A,0x33,0x2C,0x23,0x0F,0x86,0x01,0x83,0x3D,0x00,0x0C,0x84,0x01,0x00,
+    0x2C,0x82,0x3D,0x02,0x1A,0x01,0x2A,0x82,0x3D,0x00,0x1A,0x86,0x01,0x00,0x18,0x82,
+    0x3D,0x02,0x2C,0x01,0x01,0x8A,0x3D,0x00,0x1C,0x9A,0x01,0x85,0x38,0xFF,0x01,0x99,
+    0x01,0x85,0x38,0xFF,0x01,0x99,0x01,0x85,0x38,0xFF,0x01,0x99,0x01,0x85,0x38,0xFF,
+    0x01,0x99,0x01,0x85,0x38,0xFF,0x01,0x99,0x01,0x85,0x38,0xFF,0x01,0x99,0x01,0x85,
+    0x38,0xFF,0x01,0x99,0x01,0x85,0x38,0xFF,0x01,0x99,0x01,0x85,0x38,0xFF,0x01,0x99,
+    0x01,0x85,0x38,0xFF,0x01,0x99,0x01,0x85,0x38,0xFF,0x01,0x99,0x01,0x85,0x38,0xFF,
+    0x01,0x99,0x01,0x85,0x38,0xFF,0x01,0x99,0x01,0x85,0x38,0xFF,0x01,0x99,0x01,0x85,
+    0x38,0x88,0x01,0x9C,0x30,0x86,0x01,0x9C,0x09,0x86,0x01,0x9C,0x37,0x86,0x01,0x9C,
+    0x3C,0x87,0x01,0x85,0x38,0x88,0x01,0x9C,0x30,0x86,0x01,0x9C,0x09,0x86,0x01,0x9C,
+    0x37,0x86,0x01,0x9C,0x3C,0x87,0x01,0x85,0x38,0x88,0x01,0x9C,0x30,0x86,0x01,0x9C,
+    0x09,0x86,0x01,0x9C,0x37,0x86,0x01,0x9C,0x3C,0x87,0x01,0x85,0x38,0x88,0x01,0x9C,
+    0x30,0x86,0x01,0x9C,0x09,0x86,0x01,0x9C,0x37,0x86,0x01,0x9C,0x3C,0x87,0x01,0x85,
+    0x38,0x88,0x01,0x9C,0x30,0x86,0x01,0x9C,0x09,0x86,0x01,0x9C,0x37,0x86,0x01,0x9C,
+    0x3C,0x87,0x01,0x85,0x38,0x88,0x01,0x9C,0x30,0x86,0x01,0x9C,0x09,0x86,0x01,0x9C,
+    0x37,0x86,0x01,0x9C,0x3C,0x87,0x01,0x85,0x38,0x88,0x01,0x9C,0x30,0x86,0x01,0x9C,
+    0x09,0x86,0x01,0x9C,0x37,0x86,0x01,0x9C,0x3C,0x87,0x01,0x85,0x38,0x88,0x01,0x9C,
+    0x30,0x86,0x01,0x9C,0x09,0x86,0x01,0x9C,0x37,0x86,0x01,0x9C,0x3C,0x87,0x01,0x85,
+    0x38,0x88,0x01,0x9C,0x30,0x86,0x01,0x9C,0x09,0x86,0x01,0x9C,0x37,0x86,0x01,0x9C,
+    0x3C,0x87,0x01,0x85,0x38,0x88,0x01,0x9C,0x30,0x86,0x01,0x9C,0x09,0x86,0x01,0x9C,
+    0x37,0x86,0x01,0x9C,0x3C,0x87,0x01,0x85,0x38,0x88,0x01,0x9C,0x30,0x86,0x01,0x9C,
+    0x09,0x86,0x01,0x9C,0x37,0x86,0x01,0x9C,0x3C,0x87,0x01,0x85,0x38,0x88,0x01,0x9C,
+    0x30,0x86,0x01,0x9C,0x09,0x86,0x01,0x9C,0x37,0x86,0x01,0x9C,0x3C,0x87,0x01,0x85,
+    0x38,0x88,0x01,0x9C,0x30,0x86,0x01,0x9C,0x09,0x86,0x01,0x9C,0x37,0x86,0x01,0x9C,
+    0x3C,0x87,0x01,0x85,0x38,0x88,0x01,0x9C,0x30,0x86,0x01,0x9C,0x09,0x86,0x01,0x9C,
+    0x37,0x86,0x01,0x9C,0x3C,0x87,0x01,0x85,0x38,0x88,0x01,0x9C,0x30,0x86,0x01,0x9C,
+    0x09,0x86,0x01,0x9C,0x37,0x86,0x01,0x9C,0x3C,0x87,0x01,0x85,0x38,0x88,0x01,0x9C,
+    0x30,0x86,0x01,0x9C,0x09,0x86,0x01,0x9C,0x37,0x86,0x01,0x9C,0x3C,0x87,0x01,0x85,
+    0x38,0x88,0x01,0x9C,0x30,0x86,0x01,0x9C,0x09,0x86,0x01,0x9C,0x37,0x86,0x01,0x9C,
+    0x3C,0x87,0x01,0x85,0x38,0x88,0x01,0x9C,0x30,0x86,0x01,0x9C,0x09,0x86,0x01,0x9C,
+    0x37,0x86,0x01,0x9C,0x3C,0x87,0x01,0x85,0x38,0x88,0x01,0x9C,0x30,0x86,0x01,0x9C,
+    0x09,0x86,0x01,0x9C,0x37,0x86,0x01,0x9C,0x3C,0x87,0x01,0x85,0x38,0x88,0x01,0x9C,
+    0x30,0x86,0x01,0x9C,0x09,0x86,0x01,0x9C,0x37,0x86,0x01,0x9C,0x3C,0x87,0x01,0x85,
+    0x38,0x88,0x01,0x9C,0x30,0x86,0x01,0x9C,0x09,0x86,0x01,0x9C,0x37,0x86,0x01,0x9C,
+    0x3C,0x87,0x01,0x85,0x38,0x88,0x01,0x9C,0x30,0x86,0x01,0x9C,0x09,0x86,0x01,0x9C,
+    0x37,0x86,0x01,0x9C,0x3C,0x87,0x01,0x85,0x38,0x88,0x01,0x9C,0x30,0x86,0x01,0x9C,
+    0x09,0x86,0x01,0x9C,0x37,0x86,0x01,0x9C,0x3C,0x87,0x01,0x85,0x38,0xFF,0x01,0x99,
+    0x01,0x85,0x38,0xFF,0x01,0x99,0x01,0x82,0x38,0x00,0x00,0x82,0x38,0xFF,0x01,0x97,
+    0x01,0x82,0x38,0x01,0x00,0x00,0x82,0x38,0xFF,0x01,0x97,0x01,0x82,0x38,0x01,0x00,
+    0x00,0x83,0x38,0xFF,0x01,0x95,0x01,0x83,0x38,0x82,0x00,0x82,0x38,0xFF,0x01,0x95,
+    0x01,0x82,0x38,0x84,0x00,0x82,0x38,0xFF,0x01,0x93,0x01,0x82,0x38,0x85,0x00,0x83,
+    0x38,0xFF,0x01,0x91,0x01,0x83,0x38,0x86,0x00,0x84,0x38,0xFF,0x01,0x8D,0x01,0x84,
+    0x38,0x88,0x00,0x85,0x38,0xFF,0x01,0x89,0x01,0x85,0x38,0x8B,0x00,0xFF,0x38,0x91,
+    0x38,0x8E,0x00,0xFF,0x38,0x8F,0x38,0x92,0x00,0xFF,0x38,0x89,0x38,0x8A,0x00,
+};
+
+static const ILI9341_image_t badge = {
+    .palette = badge_palette,
+    .data = badge_data,
+    .width = 160,
+    .height = 80
+};
+
+#endif
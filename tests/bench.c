@@ -0,0 +1,164 @@
+    // HSE  = 25
+    // PLLM = 25
+    // PLLN = 400
+    // PLLQ = 10
+    // PLLP = 4
+    // Sysclock = 100
+
+#define BAD_PLLM (25)
+#define BAD_PLLN (400)
+#define BAD_PLLQ (10)
+#define BAD_PLLP (PLLP4)
+
+#define BAD_AHB_PRE     (HPRE_DIV_1)
+#define BAD_APB1_PRE    (PPRE_DIV_2)
+#define BAD_APB2_PRE    (PPRE_DIV_1)
+
+#define BAD_RCC_IMPLEMENTATION
+#define BAD_GPIO_IMPLEMENTATION
+#define BAD_USART_IMPLEMENTATION
+#define BAD_ADC_IMPLEMENTATION
+#define BAD_EXTI_IMPLEMENTATION
+#define BAD_FLASH_IMPLEMENTATION
+
+#define BAD_EXTI_DISPATCH_ISR_IMPLEMENTATION
+#include "badhal.h"
+
+#ifndef BAD_BUILD_PROFILE
+#define BAD_BUILD_PROFILE "unknown"
+#endif
+
+#define UART_GPIO_PORT          (GPIOA)
+#define UART1_TX_PIN            (9)
+#define UART1_RX_PIN            (10)
+#define UART1_TX_AF             (7)
+#define UART1_RX_AF             (7)
+
+#define BADHAL_FLASH_LATENCY (FLASH_LATENCY_3ws)
+
+#define BAD_BENCH_AHB1_PERIPEHRALS    (RCC_AHB1_GPIOA)
+#define BAD_BENCH_APB2_PERIPHERALS    (RCC_APB2_USART1)
+#define BAD_BENCH_UART_SETTINGS       (USART_FEATURE_TRANSMIT_EN)
+
+#define BENCH_WIDTH         (240)
+#define BENCH_HEIGHT        (120)
+#define BENCH_ADC_FRAMES    (64)
+#define BENCH_ADC_CHANNELS  (4)
+#define BENCH_EXTI_LINE     (1) // software triggered only, no pin needed
+
+static const GPIO_port_config_t uart_port = IO_PORT_CONFIG(
+    IO_PIN(UART1_TX_PIN, MODER_af, UART1_TX_AF, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull),
+    IO_PIN(UART1_RX_PIN, MODER_af, UART1_RX_AF, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull)
+);
+
+uint16_t bench_bitmap[BENCH_WIDTH * BENCH_HEIGHT] ATTR_NOINIT;
+uint16_t bench_samples[BENCH_ADC_FRAMES * BENCH_ADC_CHANNELS] __attribute__((aligned(4)));
+uint16_t bench_result[BENCH_ADC_CHANNELS];
+volatile uint32_t bench_isr_entry;
+
+//same kernel as main.c
+static APP_HOT __attribute__((noinline)) void bench_gen_bitmap(uint16_t frame){
+    for (uint16_t y = 0; y < BENCH_HEIGHT; y++) {
+        for (uint16_t x = 0; x < BENCH_WIDTH; x++) {
+            uint16_t r = ((x+frame) >> 3) & 0x1F;
+            uint16_t g = ((y+frame) >> 2) & 0x3F;
+            uint16_t b = ((x ^ y) >> 3) & 0x1F;
+            bench_bitmap[y * BENCH_WIDTH + x] = (r << 11) | (g << 5) | b;
+        }
+    }
+}
+
+static APP_HOT __attribute__((noinline)) void bench_fill(uint16_t color){
+    for (uint32_t i = 0; i < BENCH_WIDTH * BENCH_HEIGHT; i++) {
+        bench_bitmap[i] = color;
+    }
+}
+
+static APP_HOT __attribute__((noinline)) void bench_adc_reduce(){
+    adc_reduce_block(bench_samples, BENCH_ADC_FRAMES, BENCH_ADC_CHANNELS, 6, bench_result);
+}
+
+void bench_exti(uint8_t line){
+    UNUSED(line);
+    bench_isr_entry = dwt_cycles();
+}
+
+static inline void __main_clock_setup(){
+    flash_acceleration_setup(BADHAL_FLASH_LATENCY, FLASH_DCACHE_ENABLE, FLASH_ICACHE_ENABLE);
+    rcc_sysclock_setup();
+}
+
+static inline void __periph_setup(){
+    rcc_set_ahb1_clocking(BAD_BENCH_AHB1_PERIPEHRALS);
+    io_setup_port(UART_GPIO_PORT, &uart_port);
+    rcc_set_apb2_clocking(BAD_BENCH_APB2_PERIPHERALS);
+}
+
+static inline void __uart_setup(){
+    uart_setup(USART1, USART_BRR_115200, BAD_BENCH_UART_SETTINGS, 0, 0);
+    uart_enable(USART1);
+}
+
+static inline void __exti_setup(){
+    exti_set_callback(BENCH_EXTI_LINE, bench_exti);
+    exti_configure_line(BENCH_EXTI_LINE, EXTI_TRIGGER_RISING);
+    nvic_enable_interrupt(NVIC_EXTI1_INTR);
+}
+
+static void bench_report(const char *name, uint32_t cycles){
+    uart_send_str_polling(USART1, name);
+    uart_send_dec_unsigned_32bit(USART1, cycles);
+}
+
+static void bench_run(const char *tag){
+    uint32_t start;
+    uart_send_str_polling(USART1, tag);
+
+    start = dwt_cycles();
+    bench_gen_bitmap(1);
+    bench_report("GEN_BITMAP ", dwt_cycles() - start);
+
+    start = dwt_cycles();
+    bench_fill(0xF800);
+    bench_report("FILL ", dwt_cycles() - start);
+
+    start = dwt_cycles();
+    bench_adc_reduce();
+    bench_report("ADC_REDUCE ", dwt_cycles() - start);
+
+    //trigger to callback, includes the exception entry and exti_dispatch
+    start = dwt_cycles();
+    exti_software_trigger(BENCH_EXTI_LINE);
+    DSB;
+    ISB;
+    bench_report("EXTI_LATENCY ", bench_isr_entry - start);
+}
+
+int main(){
+    __DISABLE_INTERUPTS;
+    __main_clock_setup();
+    __periph_setup();
+    __uart_setup();
+    dwt_cycle_counter_enable();
+
+    for (uint32_t i = 0; i < BENCH_ADC_FRAMES * BENCH_ADC_CHANNELS; i++){
+        bench_samples[i] = (i * 37) & 0xFFF;
+    }
+
+    __exti_setup();
+    __ENABLE_INTERUPTS;
+
+    uart_send_str_polling(USART1, "PROFILE " BAD_BUILD_PROFILE "\r\n");
+#ifdef BAD_RAMFUNC_ALL
+    uart_send_str_polling(USART1, "RAMFUNC\r\n");
+#endif
+    bench_run("ART ON\r\n");
+    //every flash fetch now pays the 3 wait states, RAM placed code shouldn't care
+    flash_acceleration_setup(BADHAL_FLASH_LATENCY, FLASH_DCACHE_DISABLE, FLASH_ICACHE_DISABLE);
+    bench_run("ART OFF\r\n");
+
+    while(1){
+
+    }
+    return 0;
+}
@@ -0,0 +1,93 @@
+    // HSE  = 25
+    // PLLM = 25
+    // PLLN = 400
+    // PLLQ = 10
+    // PLLP = 4
+    // Sysclock = 100
+
+#define BAD_PLLM (25)
+#define BAD_PLLN (400)
+#define BAD_PLLQ (10)
+#define BAD_PLLP (PLLP4)
+
+#define BAD_AHB_PRE     (HPRE_DIV_1)
+#define BAD_APB1_PRE    (PPRE_DIV_2)
+#define BAD_APB2_PRE    (PPRE_DIV_1)
+
+#define BAD_RCC_IMPLEMENTATION
+#define BAD_GPIO_IMPLEMENTATION
+#define BAD_USART_IMPLEMENTATION
+#define BAD_FLASH_IMPLEMENTATION
+#include "badhal.h"
+
+#define UART_GPIO_PORT          (GPIOA)
+#define UART1_TX_PIN            (9)
+#define UART1_RX_PIN            (10)
+#define UART1_TX_AF             (7)
+#define UART1_RX_AF             (7)
+
+#define BADHAL_FLASH_LATENCY (FLASH_LATENCY_3ws)
+
+//only the boot mask, TIM2 is clocked through rcc_periph_enable
+#define BAD_CLOCKS_TEST_AHB1_PERIPEHRALS    (RCC_AHB1_GPIOA)
+#define BAD_CLOCKS_TEST_APB2_PERIPHERALS    (RCC_APB2_USART1)
+#define BAD_CLOCKS_TEST_UART_SETTINGS       (USART_FEATURE_TRANSMIT_EN)
+
+static const GPIO_port_config_t uart_port = IO_PORT_CONFIG(
+    IO_PIN(UART1_TX_PIN, MODER_af, UART1_TX_AF, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull),
+    IO_PIN(UART1_RX_PIN, MODER_af, UART1_RX_AF, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull)
+);
+
+static inline void __main_clock_setup(){
+    flash_acceleration_setup(BADHAL_FLASH_LATENCY, FLASH_DCACHE_ENABLE, FLASH_ICACHE_ENABLE);
+    rcc_sysclock_setup();
+}
+
+static inline void __periph_setup(){
+    rcc_set_ahb1_clocking(BAD_CLOCKS_TEST_AHB1_PERIPEHRALS);
+    io_setup_port(UART_GPIO_PORT, &uart_port);
+    rcc_set_apb2_clocking(BAD_CLOCKS_TEST_APB2_PERIPHERALS);
+}
+
+static inline void __uart_setup(){
+    uart_setup(USART1, USART_BRR_115200, BAD_CLOCKS_TEST_UART_SETTINGS, 0, 0);
+    uart_enable(USART1);
+}
+
+static void __check(const char *what, uint32_t ok){
+    uart_send_str_polling(USART1, what);
+    uart_send_str_polling(USART1, ok ? " OK\r\n" : " FAILED\r\n");
+}
+
+int main(){
+    __DISABLE_INTERUPTS;
+    __main_clock_setup();
+    __periph_setup();
+    __uart_setup();
+
+    __ENABLE_INTERUPTS;
+    //two drivers sharing TIM2, the clock has to survive the first one letting go
+    rcc_periph_enable(RCC_PERIPH_TIM2);
+    rcc_periph_enable(RCC_PERIPH_TIM2);
+    BTIM2->ARR = 1234;
+    __check("TIM2 WRITABLE", BTIM2->ARR == 1234);
+    rcc_periph_disable(RCC_PERIPH_TIM2);
+    __check("TIM2 STILL CLOCKED", (RCC->APB1ENR & RCC_APB1_TIM2) && BTIM2->ARR == 1234);
+
+    //reset puts ARR back to its reset value
+    rcc_periph_reset(RCC_PERIPH_TIM2);
+    __check("TIM2 RESET", BTIM2->ARR == 0xFFFFFFFF);
+
+    rcc_periph_disable(RCC_PERIPH_TIM2);
+    __check("TIM2 GATED", rcc_periph_users(RCC_PERIPH_TIM2) == 0 && !(RCC->APB1ENR & RCC_APB1_TIM2));
+    rcc_periph_disable(RCC_PERIPH_TIM2);
+    __check("UNBALANCED DISABLE IGNORED", rcc_periph_users(RCC_PERIPH_TIM2) == 0);
+
+    //the boot mask is untouched by all of this
+    __check("USART1 KEPT", RCC->APB2ENR & RCC_APB2_USART1);
+
+    while(1){
+        WFI;
+    }
+    return 0;
+}
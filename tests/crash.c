@@ -0,0 +1,96 @@
+    // HSE  = 25
+    // PLLM = 25
+    // PLLN = 400
+    // PLLQ = 10
+    // PLLP = 4
+    // Sysclock = 100
+
+#define BAD_PLLM (25)
+#define BAD_PLLN (400)
+#define BAD_PLLQ (10)
+#define BAD_PLLP (PLLP4)
+
+#define BAD_AHB_PRE     (HPRE_DIV_1)
+#define BAD_APB1_PRE    (PPRE_DIV_2)
+#define BAD_APB2_PRE    (PPRE_DIV_1)
+
+#define BAD_RCC_IMPLEMENTATION
+#define BAD_GPIO_IMPLEMENTATION
+#define BAD_USART_IMPLEMENTATION
+#define BAD_FLASH_IMPLEMENTATION
+#define BAD_SYSTICK_SYSTICK_ISR_IMPLEMENTATION
+#define BAD_RETAINED_IMPLEMENTATION
+#define BAD_CRASH_IMPLEMENTATION
+#include "crash.h"
+
+#define UART_GPIO_PORT          (GPIOA)
+#define UART1_TX_PIN            (9)
+#define UART1_RX_PIN            (10)
+#define UART1_TX_AF             (7)
+#define UART1_RX_AF             (7)
+
+#define BADHAL_FLASH_LATENCY (FLASH_LATENCY_3ws)
+
+#define BAD_CRASH_TEST_AHB1_PERIPEHRALS  (RCC_AHB1_GPIOA|RCC_AHB1_CRCEN)
+#define BAD_CRASH_TEST_APB2_PERIPHERALS  (RCC_APB2_USART1)
+#define BAD_CRASH_TEST_UART_SETTINGS     (USART_FEATURE_TRANSMIT_EN)
+#define BAD_CRASH_TEST_FAULT_MS          (3000)
+#define BAD_CRASH_TEST_BAD_ADDRESS       (0x60000000UL) // no FSMC on the F411, precise bus error
+
+static const GPIO_port_config_t uart_port = IO_PORT_CONFIG(
+    IO_PIN(UART1_TX_PIN, MODER_af, UART1_TX_AF, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull),
+    IO_PIN(UART1_RX_PIN, MODER_af, UART1_RX_AF, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull)
+);
+
+volatile uint32_t ticks;
+
+void systick_usr(){
+    ++ticks;
+}
+
+static inline void __main_clock_setup(){
+    flash_acceleration_setup(BADHAL_FLASH_LATENCY, FLASH_DCACHE_ENABLE, FLASH_ICACHE_ENABLE);
+    rcc_sysclock_setup();
+}
+
+static inline void __periph_setup(){
+    rcc_set_ahb1_clocking(BAD_CRASH_TEST_AHB1_PERIPEHRALS);
+    io_setup_port(UART_GPIO_PORT, &uart_port);
+    rcc_set_apb2_clocking(BAD_CRASH_TEST_APB2_PERIPHERALS);
+}
+
+static inline void __uart_setup(){
+    uart_setup(USART1, USART_BRR_921600, BAD_CRASH_TEST_UART_SETTINGS, 0, 0);
+    uart_enable(USART1);
+}
+
+static inline void __systick_setup(){
+    systick_setup(CLOCK_SPEED/1000, SYSTICK_FEATURE_CLOCK_SOURCE|SYSTICK_FEATURE_TICK_INTERRUPT);
+    systick_enable();
+}
+
+static __attribute__((noinline)) uint32_t crash_test_fault(){
+    return *(volatile uint32_t *)BAD_CRASH_TEST_BAD_ADDRESS;
+}
+
+int main(){
+    __DISABLE_INTERUPTS;
+    __main_clock_setup();
+    __periph_setup();
+    __uart_setup();
+    __systick_setup();
+
+    __ENABLE_INTERUPTS;
+    retained_init();
+    if (crash_pending()) {
+        crash_dump(USART1);
+        crash_clear();
+    } else {
+        uart_send_str_polling(USART1, "NO CRASH RECORD\r\n");
+    }
+
+    //fault, reset and dump on the next boot, over and over
+    while(ticks < BAD_CRASH_TEST_FAULT_MS);
+    crash_test_fault();
+    return 0;
+}
@@ -1,6 +1,7 @@
 #define BAD_PLLM (25)
 #define BAD_PLLN (400)
 #define BAD_PLLQ (10)
+#define BAD_PLLP (PLLP4)
 
 #define BAD_AHB_PRE     (HPRE_DIV_1)
 #define BAD_APB1_PRE    (PPRE_DIV_2)
@@ -55,7 +56,7 @@
 #define BADHAL_FLASH_LATENCY (FLASH_LATENCY_3ws)
 
 #define BAD_EXTI_TEST_AHB1_PERIPEHRALS    (RCC_AHB1_GPIOA)
-#define BAD_EXTI_TEST_APB2_PERIPHERALS    (RCC_APB2_USART1|RCC_APB2_SYSCFGEN)
+#define BAD_EXTI_TEST_APB2_PERIPHERALS    (RCC_APB2_USART1)
 
 volatile uint32_t exti0_triggered;
 volatile uint32_t exti1_triggered;
@@ -116,6 +117,7 @@ static inline void __periph_setup(){
     io_setup_pin(EXTI_GPIO_PORT, EXTI6_PIN, MODER_reset_input, 0, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull);
     io_setup_pin(EXTI_GPIO_PORT, EXTI7_PIN, MODER_reset_input, 0, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull);
     rcc_set_apb2_clocking(BAD_EXTI_TEST_APB2_PERIPHERALS);
+    rcc_periph_enable(RCC_PERIPH_SYSCFG); //refcounted, shared with the drivers
 }
 
 static inline void __exti_setup(){
@@ -0,0 +1,132 @@
+    // HSE  = 25
+    // PLLM = 25
+    // PLLN = 400
+    // PLLQ = 10
+    // PLLP = 4
+    // Sysclock = 100
+
+#define BAD_PLLM (25)
+#define BAD_PLLN (400)
+#define BAD_PLLQ (10)
+#define BAD_PLLP (PLLP4)
+
+#define BAD_AHB_PRE     (HPRE_DIV_1)
+#define BAD_APB1_PRE    (PPRE_DIV_2)
+#define BAD_APB2_PRE    (PPRE_DIV_1)
+
+#define BAD_RCC_IMPLEMENTATION
+#define BAD_GPIO_IMPLEMENTATION
+#define BAD_EXTI_IMPLEMENTATION
+#define BAD_EXTI_CAPTURE_IMPLEMENTATION
+#define BAD_TIMER_IMPLEMENTATION
+#define BAD_USART_IMPLEMENTATION
+#define BAD_FLASH_IMPLEMENTATION
+
+#define BAD_EXTI_DISPATCH_ISR_IMPLEMENTATION
+#define BTIMER_TIM1_UP_TIM10_ISR_IMPLEMENTATION
+#define BTIMER_USE_TIM10_USR
+#include "badhal.h"
+
+#define UART_GPIO_PORT          (GPIOA)
+#define UART1_TX_PIN            (9)
+#define UART1_RX_PIN            (10)
+#define UART1_TX_AF             (7)
+#define UART1_RX_AF             (7)
+// Encoder A/B on PB10/PB11, trigger input on PB12
+#define EXTI_GPIO_PORT          (GPIOB)
+#define SYS_CFG_EXTI_TEST_PORT  (SYSCFG_PBx)
+#define ENCODER_A_PIN           (10)
+#define ENCODER_B_PIN           (11)
+#define TRIGGER_PIN             (12)
+
+#define BADHAL_FLASH_LATENCY (FLASH_LATENCY_3ws)
+
+#define BAD_EXTI_TEST_AHB1_PERIPEHRALS    (RCC_AHB1_GPIOA|RCC_AHB1_GPIOB)
+#define BAD_EXTI_TEST_APB2_PERIPHERALS    (RCC_APB2_USART1|RCC_APB2_TIM10)
+
+//10khz debounce tick off the 100mhz APB2 timer clock, holdoff ends on a tick
+//so the tick period has to be at most the 100us encoder holdoff
+#define BAD_EXTI_TEST_TIM_ARR   (99)
+#define BAD_EXTI_TEST_TIM_PSC   (99)
+
+#define ENCODER_HOLDOFF         (CLOCK_SPEED / 10000)   //100us
+#define TRIGGER_HOLDOFF         (CLOCK_SPEED / 200)     //5ms, mechanical switch
+#define BAD_EXTI_TEST_UART_SETTINGS (USART_FEATURE_TRANSMIT_EN)
+
+static const GPIO_port_config_t uart_port = IO_PORT_CONFIG(
+    IO_PIN(UART1_TX_PIN, MODER_af, UART1_TX_AF, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull),
+    IO_PIN(UART1_RX_PIN, MODER_af, UART1_RX_AF, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull)
+);
+
+static const GPIO_port_config_t exti_port = IO_PORT_CONFIG(
+    IO_PIN(ENCODER_A_PIN, MODER_reset_input, 0, OSPEEDR_low_speed, PUPDR_pullup, OTYPR_push_pull),
+    IO_PIN(ENCODER_B_PIN, MODER_reset_input, 0, OSPEEDR_low_speed, PUPDR_pullup, OTYPR_push_pull),
+    IO_PIN(TRIGGER_PIN, MODER_reset_input, 0, OSPEEDR_low_speed, PUPDR_pullup, OTYPR_push_pull)
+);
+
+void tim10_usr(){
+    exti_debounce_tick();
+}
+
+static inline void __main_clock_setup(){
+    flash_acceleration_setup(BADHAL_FLASH_LATENCY, FLASH_DCACHE_ENABLE, FLASH_ICACHE_ENABLE);
+    rcc_sysclock_setup();
+}
+
+static inline void __periph_setup(){
+    rcc_set_ahb1_clocking(BAD_EXTI_TEST_AHB1_PERIPEHRALS);
+    io_setup_port(UART_GPIO_PORT, &uart_port);
+    io_setup_port(EXTI_GPIO_PORT, &exti_port);
+    rcc_set_apb2_clocking(BAD_EXTI_TEST_APB2_PERIPHERALS);
+    rcc_periph_enable(RCC_PERIPH_SYSCFG); //refcounted, shared with the drivers
+}
+
+static inline void __uart_setup(){
+    uart_setup(USART1, USART_BRR_115200, BAD_EXTI_TEST_UART_SETTINGS, 0, 0);
+    uart_enable(USART1);
+}
+
+static inline void __exti_setup(){
+    syscfg_set_exti_pin(SYS_CFG_EXTI_TEST_PORT, ENCODER_A_PIN);
+    syscfg_set_exti_pin(SYS_CFG_EXTI_TEST_PORT, ENCODER_B_PIN);
+    syscfg_set_exti_pin(SYS_CFG_EXTI_TEST_PORT, TRIGGER_PIN);
+    exti_capture_setup(ENCODER_A_PIN, EXTI_GPIO_PORT, ENCODER_HOLDOFF);
+    exti_capture_setup(ENCODER_B_PIN, EXTI_GPIO_PORT, ENCODER_HOLDOFF);
+    exti_capture_setup(TRIGGER_PIN, EXTI_GPIO_PORT, TRIGGER_HOLDOFF);
+    exti_configure_line(ENCODER_A_PIN, EXTI_TRIGGER_BOTH);
+    exti_configure_line(ENCODER_B_PIN, EXTI_TRIGGER_BOTH);
+    exti_configure_line(TRIGGER_PIN, EXTI_TRIGGER_FALLING);
+    nvic_enable_interrupt(NVIC_EXTI15_10_INTR);
+}
+
+static inline void __timer_setup(){
+    basic_timer_setup(BTIM10, BAD_EXTI_TEST_TIM_ARR, BAD_EXTI_TEST_TIM_PSC, BTIMER_UPDATE);
+    nvic_enable_interrupt(NVIC_TIM1_UP_TIM10_INTR);
+    tim_enable(BTIM10);
+}
+
+int main(){
+    __DISABLE_INTERUPTS;
+    __main_clock_setup();
+    __periph_setup();
+    __uart_setup();
+    dwt_cycle_counter_enable();
+    __exti_setup();
+    __timer_setup();
+
+    __ENABLE_INTERUPTS;
+    EXTI_capture_event_t event;
+    uint32_t last = 0;
+    while(1){
+        if(exti_capture_pop(&event)){
+            uart_send_str_polling(USART1, "LINE ");
+            uart_send_dec_unsigned_32bit(USART1, event.line);
+            uart_send_str_polling(USART1, "LEVEL ");
+            uart_send_dec_unsigned_32bit(USART1, event.level);
+            uart_send_str_polling(USART1, "DT CYCLES ");
+            uart_send_dec_unsigned_32bit(USART1, event.timestamp - last);
+            last = event.timestamp;
+        }
+    }
+    return 0;
+}
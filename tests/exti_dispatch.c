@@ -0,0 +1,87 @@
+    // HSE  = 25
+    // PLLM = 25
+    // PLLN = 400
+    // PLLQ = 10
+    // PLLP = 4
+    // Sysclock = 100
+
+#define BAD_PLLM (25)
+#define BAD_PLLN (400)
+#define BAD_PLLQ (10)
+#define BAD_PLLP (PLLP4)
+
+#define BAD_AHB_PRE     (HPRE_DIV_1)
+#define BAD_APB1_PRE    (PPRE_DIV_2)
+#define BAD_APB2_PRE    (PPRE_DIV_1)
+
+#define BAD_RCC_IMPLEMENTATION
+#define BAD_GPIO_IMPLEMENTATION
+#define BAD_EXTI_IMPLEMENTATION
+#define BAD_FLASH_IMPLEMENTATION
+
+#define BAD_EXTI_DISPATCH_ISR_IMPLEMENTATION
+#include "badhal.h"
+
+// PB10-PB13 interrupt, PB15 event only (wakes the WFE in main)
+#define EXTI_GPIO_PORT          (GPIOB)
+#define SYS_CFG_EXTI_TEST_PORT  (SYSCFG_PBx)
+#define EXTI_FIRST_PIN          (10)
+#define EXTI_LAST_PIN           (13)
+#define EXTI_EVENT_PIN          (15)
+
+#define BADHAL_FLASH_LATENCY (FLASH_LATENCY_3ws)
+
+#define BAD_EXTI_TEST_AHB1_PERIPEHRALS    (RCC_AHB1_GPIOB)
+
+static const GPIO_port_config_t exti_port = IO_PORT_CONFIG(
+    IO_PIN(10, MODER_reset_input, 0, OSPEEDR_low_speed, PUPDR_pullup, OTYPR_push_pull),
+    IO_PIN(11, MODER_reset_input, 0, OSPEEDR_low_speed, PUPDR_pullup, OTYPR_push_pull),
+    IO_PIN(12, MODER_reset_input, 0, OSPEEDR_low_speed, PUPDR_pullup, OTYPR_push_pull),
+    IO_PIN(13, MODER_reset_input, 0, OSPEEDR_low_speed, PUPDR_pullup, OTYPR_push_pull),
+    IO_PIN(15, MODER_reset_input, 0, OSPEEDR_low_speed, PUPDR_pullup, OTYPR_push_pull)
+);
+
+volatile uint32_t exti_triggered[EXTI_LINE_COUNT];
+volatile uint32_t wakeups;
+
+void exti_count(uint8_t line){
+    exti_triggered[line]++;
+}
+
+static inline void __main_clock_setup(){
+    flash_acceleration_setup(BADHAL_FLASH_LATENCY, FLASH_DCACHE_ENABLE, FLASH_ICACHE_ENABLE);
+    rcc_sysclock_setup();
+}
+
+static inline void __periph_setup(){
+    rcc_set_ahb1_clocking(BAD_EXTI_TEST_AHB1_PERIPEHRALS);
+    io_setup_port(EXTI_GPIO_PORT, &exti_port);
+    rcc_periph_enable(RCC_PERIPH_SYSCFG); //refcounted, shared with the drivers
+}
+
+static inline void __exti_setup(){
+    for (uint8_t pin = EXTI_FIRST_PIN; pin <= EXTI_LAST_PIN; pin++){
+        syscfg_set_exti_pin(SYS_CFG_EXTI_TEST_PORT, pin);
+        exti_set_callback(pin, exti_count);
+        exti_configure_line(pin, EXTI_TRIGGER_FALLING);
+    }
+    syscfg_set_exti_pin(SYS_CFG_EXTI_TEST_PORT, EXTI_EVENT_PIN);
+    exti_configure_line_mode(EXTI_EVENT_PIN, EXTI_TRIGGER_BOTH, EXTI_MODE_EVENT);
+    nvic_enable_interrupt(NVIC_EXTI15_10_INTR);
+}
+
+int main(){
+    __DISABLE_INTERUPTS;
+    __main_clock_setup();
+    __periph_setup();
+    __exti_setup();
+
+    __ENABLE_INTERUPTS;
+    exti_software_trigger(EXTI_FIRST_PIN); //self test, exti_triggered[10] should be 1
+
+    while(1){
+        WFE;
+        wakeups++;
+    }
+    return 0;
+}
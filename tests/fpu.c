@@ -0,0 +1,117 @@
+    // HSE  = 25
+    // PLLM = 25
+    // PLLN = 400
+    // PLLQ = 10
+    // PLLP = 4
+    // Sysclock = 100
+
+#define BAD_PLLM (25)
+#define BAD_PLLN (400)
+#define BAD_PLLQ (10)
+#define BAD_PLLP (PLLP4)
+
+#define BAD_AHB_PRE     (HPRE_DIV_1)
+#define BAD_APB1_PRE    (PPRE_DIV_2)
+#define BAD_APB2_PRE    (PPRE_DIV_1)
+
+#define BAD_RCC_IMPLEMENTATION
+#define BAD_GPIO_IMPLEMENTATION
+#define BAD_USART_IMPLEMENTATION
+#define BAD_EXTI_IMPLEMENTATION
+#define BAD_FLASH_IMPLEMENTATION
+#define BAD_FPU_IMPLEMENTATION
+#define BAD_FPU_MEASURE
+#include "badhal.h"
+
+#define UART_GPIO_PORT          (GPIOA)
+#define UART1_TX_PIN            (9)
+#define UART1_RX_PIN            (10)
+#define UART1_TX_AF             (7)
+#define UART1_RX_AF             (7)
+
+#define BADHAL_FLASH_LATENCY (FLASH_LATENCY_3ws)
+
+#define BAD_FPU_TEST_AHB1_PERIPEHRALS  (RCC_AHB1_GPIOA)
+#define BAD_FPU_TEST_APB2_PERIPHERALS  (RCC_APB2_USART1)
+#define BAD_FPU_TEST_UART_SETTINGS     (USART_FEATURE_TRANSMIT_EN)
+#define BAD_FPU_TEST_EXTI_LINE         (1) // software triggered only
+#define BAD_FPU_TEST_REPORT_MS         (1000)
+
+static const GPIO_port_config_t uart_port = IO_PORT_CONFIG(
+    IO_PIN(UART1_TX_PIN, MODER_af, UART1_TX_AF, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull),
+    IO_PIN(UART1_RX_PIN, MODER_af, UART1_RX_AF, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull)
+);
+
+volatile uint32_t ticks;
+volatile float phase;
+volatile float gain = 1.5f;
+
+//integer only, lazy_saves has to stay 0
+FPU_FREE_ISR(systick_isr){
+    ++ticks;
+    if ((ticks & 0x3F) == 0) {
+        exti_software_trigger(BAD_FPU_TEST_EXTI_LINE);
+    }
+}
+
+//wrongly marked on purpose, every entry over the float loop in main shows up as a lazy save
+FPU_FREE_ISR(exti1_isr){
+    exti_clear_pending(BAD_FPU_TEST_EXTI_LINE);
+    phase = phase * gain;
+}
+
+static inline void __main_clock_setup(){
+    flash_acceleration_setup(BADHAL_FLASH_LATENCY, FLASH_DCACHE_ENABLE, FLASH_ICACHE_ENABLE);
+    rcc_sysclock_setup();
+}
+
+static inline void __periph_setup(){
+    rcc_set_ahb1_clocking(BAD_FPU_TEST_AHB1_PERIPEHRALS);
+    io_setup_port(UART_GPIO_PORT, &uart_port);
+    rcc_set_apb2_clocking(BAD_FPU_TEST_APB2_PERIPHERALS);
+}
+
+static inline void __uart_setup(){
+    uart_setup(USART1, USART_BRR_115200, BAD_FPU_TEST_UART_SETTINGS, 0, 0);
+    uart_enable(USART1);
+}
+
+static inline void __interrupt_setup(){
+    systick_setup(CLOCK_SPEED/1000, SYSTICK_FEATURE_CLOCK_SOURCE|SYSTICK_FEATURE_TICK_INTERRUPT);
+    systick_enable();
+    exti_configure_line(BAD_FPU_TEST_EXTI_LINE, EXTI_TRIGGER_RISING);
+    nvic_enable_interrupt(NVIC_EXTI1_INTR);
+}
+
+static void fpu_test_report(const char *name, const FPU_lazy_stats_t *stats){
+    uart_send_str_polling(USART1, name);
+    uart_send_str_polling(USART1, "ENTRIES ");
+    uart_send_dec_unsigned_32bit(USART1, stats->entries);
+    uart_send_str_polling(USART1, "FP ENTRIES ");
+    uart_send_dec_unsigned_32bit(USART1, stats->fp_entries);
+    uart_send_str_polling(USART1, "LAZY SAVES ");
+    uart_send_dec_unsigned_32bit(USART1, stats->lazy_saves);
+}
+
+int main(){
+    __DISABLE_INTERUPTS;
+    __main_clock_setup();
+    __periph_setup();
+    __uart_setup();
+    __interrupt_setup();
+
+    __ENABLE_INTERUPTS;
+
+    uint32_t next = BAD_FPU_TEST_REPORT_MS;
+    float acc = 0.0f;
+    while(1){
+        acc = acc * 0.5f + 1.0f; //keeps a float context live in thread mode
+        if (ticks >= next) {
+            next += BAD_FPU_TEST_REPORT_MS;
+            fpu_test_report("SYSTICK\r\n", &systick_isr_fpu_stats);
+            fpu_test_report("EXTI1\r\n", &exti1_isr_fpu_stats);
+            phase = acc;
+        }
+    }
+    return 0;
+}
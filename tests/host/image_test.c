@@ -0,0 +1,151 @@
+// Host test of the ili9341_image.h decoder: make host-test
+// The sample asset decoded in one go, in stripes and pixel by pixel has to
+// come out the same, with known colors where the PNG has them. The display
+// calls are stubbed with a RAM screen to check the stripe windows, and a
+// transfer stays "on the wire" until the next wait, a stripe rewritten or
+// given back to the pool before that is caught.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BAD_ILI9341_IMAGE_IMPLEMENTATION
+#include "ili9341_image.h"
+#include "../assets/badge.h"
+
+#define PIXELS (160 * 80)
+#define STRIPE_ROWS (16) //5 stripes for the badge, odd on purpose
+
+POOL_DEFINE(stripes, 160 * STRIPE_ROWS * sizeof(uint16_t), 2, 16);
+POOL_DEFINE(single, 160 * STRIPE_ROWS * sizeof(uint16_t), 1, 16);
+POOL_DEFINE(tiny, 8 * sizeof(uint16_t), 2, 16);
+
+static uint16_t whole[PIXELS];
+static uint16_t chunked[PIXELS];
+
+static int failures;
+static uint16_t screen[ILI9341_LCD_HEIGHT][ILI9341_LCD_WIDTH];
+static uint32_t fills;
+static const uint16_t *in_flight;
+static uint32_t in_flight_len;
+static uint32_t in_flight_sum;
+
+#define CHECK(x) do { if (!(x)) { printf("FAIL %s:%d %s\n", __FILE__, __LINE__, #x); failures++; } } while (0)
+
+static uint32_t sum(const uint16_t *fb, uint32_t len){
+    uint32_t h = 0;
+    while (len--) {
+        h = h * 31 + *fb++;
+    }
+    return h;
+}
+
+void ili9341_wait_dma_ready(){
+    if (in_flight) {
+        CHECK(sum(in_flight, in_flight_len) == in_flight_sum); //written while on the wire
+        in_flight = 0;
+    }
+}
+
+uint16_t ili9341_width(void){
+    return ILI9341_LCD_WIDTH;
+}
+
+uint16_t ili9341_height(void){
+    return ILI9341_LCD_HEIGHT;
+}
+
+void ili9341_fb_dma_fill(uint16_t* fb, uint16_t x_start, uint16_t y_start,uint16_t x_end,uint16_t y_end){
+    CHECK(((uintptr_t)fb & 0xF) == 0);
+    CHECK(x_end < ILI9341_LCD_WIDTH && y_end < ILI9341_LCD_HEIGHT);
+    CHECK(!in_flight);
+    in_flight_len = (uint32_t)(x_end - x_start + 1) * (y_end - y_start + 1);
+    CHECK(in_flight_len % ILI9341_IMAGE_BURST_PIXELS == 0);
+    in_flight = fb;
+    in_flight_sum = sum(fb, in_flight_len);
+    for (uint16_t y = y_start; y <= y_end; y++) {
+        for (uint16_t x = x_start; x <= x_end; x++) {
+            screen[y][x] = *fb++;
+        }
+    }
+    fills++;
+}
+
+static void test_draw(pool_t *pool){
+    fills = 0;
+    for (uint32_t i = 0; i < 2; i++) {
+        memset(screen, 0, sizeof(screen));
+        CHECK(ili9341_draw_image(&badge, 40, 100, pool));
+        CHECK(!in_flight && pool_used(pool) == 0); //blocks given back after the last stripe
+    }
+    CHECK(fills == 2 * ((80 + STRIPE_ROWS - 1) / STRIPE_ROWS));
+    uint32_t mismatches = 0;
+    for (uint32_t y = 0; y < 80; y++) {
+        for (uint32_t x = 0; x < 160; x++) {
+            mismatches += screen[100 + y][40 + x] != whole[y * 160 + x];
+        }
+    }
+    CHECK(mismatches == 0);
+    CHECK(screen[99][40] == 0 && screen[180][40] == 0);
+}
+
+//12 wide: stripes are rounded to an even row count so they stay whole bursts
+static void test_odd_width(){
+    static const uint16_t palette[1] = {0x1234};
+    static uint8_t data[25 * 2];
+    for (uint32_t i = 0; i < 25; i++) {
+        data[i * 2] = ILI9341_IMAGE_RUN | 119;
+        data[i * 2 + 1] = 0;
+    }
+    const ILI9341_image_t strip = {palette, data, 12, 250};
+    fills = 0;
+    CHECK(ili9341_draw_image(&strip, 0, 0, &stripes));
+    CHECK(fills == 2);
+    CHECK(screen[0][0] == 0x1234 && screen[249][11] == 0x1234);
+}
+
+//nothing drawn without a block, or with blocks too small for 8 pixels of rows
+static void test_no_blocks(){
+    void *taken[2] = {pool_alloc(&stripes), pool_alloc(&stripes)};
+    fills = 0;
+    CHECK(!ili9341_draw_image(&badge, 40, 100, &stripes));
+    CHECK(!ili9341_draw_image(&badge, 40, 100, &tiny));
+    CHECK(fills == 0 && pool_used(&tiny) == 0);
+    pool_free(&stripes, taken[0]);
+    pool_free(&stripes, taken[1]);
+}
+
+static void decode_in(uint32_t chunk){
+    ILI9341_image_decoder_t dec;
+    ili9341_image_decoder_init(&dec, &badge);
+    for (uint32_t done = 0; done < PIXELS; done += chunk) {
+        uint32_t n = PIXELS - done < chunk ? PIXELS - done : chunk;
+        ili9341_image_decode(&dec, &chunked[done], n);
+    }
+    uint32_t mismatches = 0;
+    for (uint32_t i = 0; i < PIXELS; i++) {
+        mismatches += chunked[i] != whole[i];
+    }
+    CHECK(mismatches == 0);
+    CHECK(dec.src == badge_data + sizeof(badge_data)); //the whole stream, nothing more
+}
+
+int main(){
+    ILI9341_image_decoder_t dec;
+    ili9341_image_decoder_init(&dec, &badge);
+    ili9341_image_decode(&dec, whole, PIXELS);
+    CHECK(dec.src == badge_data + sizeof(badge_data));
+    CHECK(dec.remaining == 0);
+
+    CHECK(whole[0] == 0x0000);                   //transparent corner -> background
+    CHECK(whole[55 * 160 + 26] == 0xD945);       //first bar, (220,40,40)
+
+    decode_in(1);
+    decode_in(7);
+    decode_in(160 * 16);
+    test_draw(&stripes);
+    test_draw(&single); //decode and DMA take turns on one block
+    test_odd_width();
+    test_no_blocks();
+    printf(failures ? "image: %d FAILED\n" : "image: OK\n", failures);
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,100 @@
+// Host test of pool.h on the C11 atomics backend: make host-test
+// Threads allocate, stamp, check and free blocks. A block handed out twice
+// shows up as a stamp changing under its owner.
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "pool.h"
+
+#define THREADS     (4)
+#define ROUNDS      (200000U)
+#define BLOCKS      (8)
+
+POOL_DEFINE(blocks, 40, BLOCKS, 16);
+POOL_DEFINE(bytes, 5, 3, 1);
+
+static int failures;
+
+#define CHECK(x) do { if (!(x)) { printf("FAIL %s:%d %s\n", __FILE__, __LINE__, #x); failures++; } } while (0)
+
+static void *worker(void *arg){
+    uint32_t id = (uint32_t)(uintptr_t)arg;
+    for (uint32_t round = 0; round < ROUNDS; round++) {
+        uint32_t *block = pool_alloc(&blocks);
+        if (!block) {
+            sched_yield();
+            continue;
+        }
+        CHECK(pool_owns(&blocks, block));
+        CHECK(((uintptr_t)block & 0xF) == 0);
+        block[1] = id;
+        block[2] = round;
+        if (!(round & 0xFF)) {
+            sched_yield();
+        }
+        if (block[1] != id || block[2] != round) {
+            CHECK(block[1] == id && block[2] == round);
+            return 0;
+        }
+        pool_free(&blocks, block);
+    }
+    return 0;
+}
+
+static void test_sizes(){
+    CHECK(blocks.block_size == 48);
+    CHECK(POOL_STRIDE(1, 1) == 4);
+    CHECK(POOL_STRIDE(20, 4) == 20);
+    CHECK(POOL_STRIDE(5, 1) == 8 && POOL_STRIDE(6, 2) == 8);
+    //byte aligned blocks still keep the link word aligned
+    void *a = pool_alloc(&bytes);
+    void *b = pool_alloc(&bytes);
+    CHECK(bytes.block_size == 8);
+    CHECK(((uintptr_t)a & 3) == 0 && ((uintptr_t)b & 3) == 0);
+    pool_free(&bytes, a);
+    pool_free(&bytes, b);
+    CHECK(pool_alloc(&bytes) == b);
+}
+
+static void test_exhaustion(){
+    void *taken[BLOCKS];
+    uint32_t exhausted = pool_exhausted(&blocks);
+    for (uint32_t i = 0; i < BLOCKS; i++) {
+        taken[i] = pool_alloc(&blocks);
+        CHECK(taken[i] != 0);
+        for (uint32_t j = 0; j < i; j++) {
+            CHECK(taken[i] != taken[j]);
+        }
+    }
+    CHECK(pool_alloc(&blocks) == 0);
+    CHECK(pool_exhausted(&blocks) == exhausted + 1);
+    CHECK(pool_used(&blocks) == BLOCKS);
+    CHECK(pool_high_water(&blocks) == BLOCKS);
+    for (uint32_t i = 0; i < BLOCKS; i++) {
+        pool_free(&blocks, taken[i]);
+    }
+    CHECK(pool_used(&blocks) == 0);
+}
+
+static void test_threads(){
+    pthread_t threads[THREADS];
+    for (uint32_t i = 0; i < THREADS; i++) {
+        pthread_create(&threads[i], 0, worker, (void *)(uintptr_t)i);
+    }
+    for (uint32_t i = 0; i < THREADS; i++) {
+        pthread_join(threads[i], 0);
+    }
+    CHECK(pool_used(&blocks) == 0);
+    CHECK(pool_high_water(&blocks) <= BLOCKS);
+}
+
+int main(){
+    test_sizes();
+    test_exhaustion();
+    test_threads();
+    test_exhaustion(); //the free list is intact after all that
+    printf(failures ? "pool: %d FAILED\n" : "pool: OK\n", failures);
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
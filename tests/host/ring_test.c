@@ -0,0 +1,142 @@
+// Host test of ring.h on the C11 atomics backend: make host-test
+// (sched_yield keeps it quick on a single core machine)
+// One producer thread for the byte ring, several for the message ring, the
+// main thread consumes and checks that nothing is lost, duplicated or reordered.
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "ring.h"
+
+#define BYTES_TOTAL     (1000000U)
+#define PRODUCERS       (4)
+#define MSGS_PER_THREAD (200000U)
+
+RING_DEFINE(bytes, 64);
+RING_MSG_DEFINE(msgs, sizeof(uint32_t) * 2, 16);
+
+static int failures;
+
+#define CHECK(x) do { if (!(x)) { printf("FAIL %s:%d %s\n", __FILE__, __LINE__, #x); failures++; } } while (0)
+
+static void *byte_producer(void *arg){
+    (void)arg;
+    uint32_t next = 0;
+    while (next < BYTES_TOTAL) {
+        //mix single pushes and spans so both paths wrap around
+        if (next & 1) {
+            if (ring_push(&bytes, (uint8_t)next)) {
+                next++;
+            } else {
+                sched_yield();
+            }
+        } else {
+            uint8_t *span;
+            uint32_t len = ring_write_span(&bytes, &span);
+            if (!len) {
+                sched_yield();
+            }
+            if (len > BYTES_TOTAL - next) {
+                len = BYTES_TOTAL - next;
+            }
+            for (uint32_t i = 0; i < len; i++) {
+                span[i] = (uint8_t)(next + i);
+            }
+            ring_write_commit(&bytes, len);
+            next += len;
+        }
+    }
+    return 0;
+}
+
+static void test_bytes(){
+    pthread_t thread;
+    pthread_create(&thread, 0, byte_producer, 0);
+    uint32_t expect = 0;
+    uint8_t buf[24];
+    while (expect < BYTES_TOTAL) {
+        uint32_t got = ring_read(&bytes, buf, sizeof(buf));
+        if (!got) {
+            sched_yield();
+        }
+        for (uint32_t i = 0; i < got; i++) {
+            if (buf[i] != (uint8_t)expect) {
+                CHECK(buf[i] == (uint8_t)expect);
+                expect = BYTES_TOTAL;
+                break;
+            }
+            expect++;
+        }
+    }
+    pthread_join(thread, 0);
+    CHECK(ring_count(&bytes) == 0);
+    CHECK(ring_free(&bytes) == 64);
+}
+
+static void *msg_producer(void *arg){
+    uint32_t id = (uint32_t)(uintptr_t)arg;
+    for (uint32_t seq = 0; seq < MSGS_PER_THREAD;) {
+        uint32_t msg[2] = {id, seq};
+        if (ring_msg_push(&msgs, msg, sizeof(msg))) {
+            seq++;
+        } else {
+            sched_yield();
+        }
+    }
+    return 0;
+}
+
+static void test_msgs(){
+    pthread_t threads[PRODUCERS];
+    for (uint32_t i = 0; i < PRODUCERS; i++) {
+        pthread_create(&threads[i], 0, msg_producer, (void *)(uintptr_t)i);
+    }
+    uint32_t next[PRODUCERS] = {0};
+    uint32_t received = 0;
+    while (received < PRODUCERS * MSGS_PER_THREAD) {
+        uint32_t msg[2];
+        if (!ring_msg_pop(&msgs, msg, sizeof(msg))) {
+            sched_yield();
+            continue;
+        }
+        CHECK(msg[0] < PRODUCERS);
+        if (msg[0] >= PRODUCERS || msg[1] != next[msg[0]]) {
+            CHECK(msg[1] == next[msg[0] % PRODUCERS]);
+            break;
+        }
+        next[msg[0]]++;
+        received++;
+    }
+    for (uint32_t i = 0; i < PRODUCERS; i++) {
+        pthread_join(threads[i], 0);
+    }
+    CHECK(received == PRODUCERS * MSGS_PER_THREAD);
+    CHECK(ring_msg_peek(&msgs) == 0);
+
+    //full ring refuses and counts, the slots come back after a pop
+    uint32_t msg[2] = {0, 0};
+    uint32_t dropped = ring_msg_dropped(&msgs);
+    for (uint32_t i = 0; i < 16; i++) {
+        CHECK(ring_msg_push(&msgs, msg, sizeof(msg)));
+    }
+    CHECK(!ring_msg_push(&msgs, msg, sizeof(msg)));
+    CHECK(ring_msg_dropped(&msgs) == dropped + 1);
+    CHECK(ring_msg_pop(&msgs, msg, sizeof(msg)));
+    CHECK(ring_msg_push(&msgs, msg, sizeof(msg)));
+
+    //a message bigger than a slot is refused, nothing is claimed or counted as dropped
+    uint32_t big[3] = {1, 2, 3};
+    while (ring_msg_pop(&msgs, msg, sizeof(msg))) {
+    }
+    dropped = ring_msg_dropped(&msgs);
+    CHECK(!ring_msg_push(&msgs, big, sizeof(big)));
+    CHECK(ring_msg_peek(&msgs) == 0 && ring_msg_dropped(&msgs) == dropped);
+}
+
+int main(){
+    test_bytes();
+    test_msgs();
+    printf(failures ? "ring: %d FAILED\n" : "ring: OK\n", failures);
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,136 @@
+    // HSE  = 25
+    // PLLM = 25
+    // PLLN = 400
+    // PLLQ = 10
+    // PLLP = 4
+    // Sysclock = 100
+
+#define BAD_PLLM (25)
+#define BAD_PLLN (400)
+#define BAD_PLLQ (10)
+#define BAD_PLLP (PLLP4)
+
+#define BAD_AHB_PRE     (HPRE_DIV_1)
+#define BAD_APB1_PRE    (PPRE_DIV_2)
+#define BAD_APB2_PRE    (PPRE_DIV_1)
+
+#define BAD_RCC_IMPLEMENTATION
+#define BAD_GPIO_IMPLEMENTATION
+#define BAD_USART_IMPLEMENTATION
+#define BAD_EXTI_IMPLEMENTATION
+#define BAD_FLASH_IMPLEMENTATION
+#define BAD_PWR_IMPLEMENTATION
+
+#define BAD_EXTI_DISPATCH_ISR_IMPLEMENTATION
+#include "badhal.h"
+
+#define UART_GPIO_PORT          (GPIOA)
+#define UART1_TX_PIN            (9)
+#define UART1_RX_PIN            (10)
+#define UART1_TX_AF             (7)
+#define UART1_RX_AF             (7)
+
+// PB12 to ground wakes stop early
+#define EXTI_GPIO_PORT          (GPIOB)
+#define SYS_CFG_EXTI_TEST_PORT  (SYSCFG_PBx)
+#define EXTI_WAKE_PIN           (12)
+
+#define BADHAL_FLASH_LATENCY (FLASH_LATENCY_3ws)
+
+#define BAD_IDLE_TEST_AHB1_PERIPEHRALS  (RCC_AHB1_GPIOA|RCC_AHB1_GPIOB)
+#define BAD_IDLE_TEST_APB1_PERIPHERALS  (RCC_APB1_PWR)
+#define BAD_IDLE_TEST_APB2_PERIPHERALS  (RCC_APB2_USART1)
+#define BAD_IDLE_TEST_UART_SETTINGS     (USART_FEATURE_TRANSMIT_EN)
+#define BAD_IDLE_TEST_WAKEUP_MS         (1000)
+#define BAD_IDLE_TEST_SLEEPS            (5)
+
+static const GPIO_port_config_t uart_port = IO_PORT_CONFIG(
+    IO_PIN(UART1_TX_PIN, MODER_af, UART1_TX_AF, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull),
+    IO_PIN(UART1_RX_PIN, MODER_af, UART1_RX_AF, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull)
+);
+
+volatile uint32_t rtc_wakeups;
+volatile uint32_t pin_wakeups;
+
+void rtc_wakeup(uint8_t line){
+    UNUSED(line);
+    rtc_wakeup_clear();
+    rtc_wakeups++;
+}
+
+void pin_wakeup(uint8_t line){
+    UNUSED(line);
+    pin_wakeups++;
+}
+
+static inline void __main_clock_setup(){
+    flash_acceleration_setup(BADHAL_FLASH_LATENCY, FLASH_DCACHE_ENABLE, FLASH_ICACHE_ENABLE);
+    rcc_sysclock_setup();
+}
+
+static inline void __periph_setup(){
+    rcc_set_ahb1_clocking(BAD_IDLE_TEST_AHB1_PERIPEHRALS);
+    io_setup_port(UART_GPIO_PORT, &uart_port);
+    io_setup_pin(EXTI_GPIO_PORT, EXTI_WAKE_PIN, MODER_reset_input, 0, OSPEEDR_low_speed, PUPDR_pullup, OTYPR_push_pull);
+    rcc_set_apb1_clocking(BAD_IDLE_TEST_APB1_PERIPHERALS);
+    rcc_set_apb2_clocking(BAD_IDLE_TEST_APB2_PERIPHERALS);
+    rcc_periph_enable(RCC_PERIPH_SYSCFG); //refcounted, shared with the drivers
+    rcc_gate_sleep_clocks();
+}
+
+static inline void __uart_setup(){
+    uart_setup(USART1, USART_BRR_115200, BAD_IDLE_TEST_UART_SETTINGS, 0, 0);
+    uart_enable(USART1);
+}
+
+static inline void __wakeup_setup(){
+    exti_set_callback(EXTI_LINE_RTC_WKUP, rtc_wakeup);
+    exti_configure_line(EXTI_LINE_RTC_WKUP, EXTI_TRIGGER_RISING);
+    nvic_enable_interrupt(NVIC_RTC_WKUP_INTR);
+    rtc_wakeup_setup(BAD_IDLE_TEST_WAKEUP_MS);
+
+    syscfg_set_exti_pin(SYS_CFG_EXTI_TEST_PORT, EXTI_WAKE_PIN);
+    exti_set_callback(EXTI_WAKE_PIN, pin_wakeup);
+    exti_configure_line(EXTI_WAKE_PIN, EXTI_TRIGGER_FALLING);
+    nvic_enable_interrupt(NVIC_EXTI15_10_INTR);
+}
+
+static void __report(){
+    uart_send_str_polling(USART1, "RUN CYCLES: ");
+    uart_send_dec_unsigned_32bit(USART1, (uint32_t)idle_stats.run_cycles);
+    uart_send_str_polling(USART1, "SLEEP CYCLES: ");
+    uart_send_dec_unsigned_32bit(USART1, (uint32_t)idle_stats.sleep_cycles);
+    uart_send_str_polling(USART1, "SLEEPS: ");
+    uart_send_dec_unsigned_32bit(USART1, idle_stats.sleep_entries);
+    uart_send_str_polling(USART1, "STOPS: ");
+    uart_send_dec_unsigned_32bit(USART1, idle_stats.stop_entries);
+    uart_send_str_polling(USART1, "STOP MS: ");
+    uart_send_dec_unsigned_32bit(USART1, idle_stats.stop_ms);
+    uart_send_str_polling(USART1, "PIN WAKEUPS: ");
+    uart_send_dec_unsigned_32bit(USART1, pin_wakeups);
+    uart_send_str_polling(USART1, "\r\n");
+}
+
+int main(){
+    __DISABLE_INTERUPTS;
+    __main_clock_setup();
+    __periph_setup();
+    __uart_setup();
+    __wakeup_setup();
+    dwt_cycle_counter_enable();
+    idle_stats_reset();
+
+    __ENABLE_INTERUPTS;
+    //sleep: the RTC wakeup is the only interrupt, every WFI should last a full period
+    uint32_t wait_for = rtc_wakeups + BAD_IDLE_TEST_SLEEPS;
+    IDLE_WAIT_UNTIL(rtc_wakeups >= wait_for);
+    __report();
+
+    //stop: the UART is clocked off too, wait for the last byte before going down
+    while(1){
+        while(!(USART1->SR & USART_SR_TC));
+        idle_stop(PWR_STOP_LOW_POWER_REGULATOR);
+        __report();
+    }
+    return 0;
+}
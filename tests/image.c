@@ -0,0 +1,109 @@
+    // HSE  = 25
+    // PLLM = 25
+    // PLLN = 400
+    // PLLQ = 10
+    // PLLP = 4
+    // Sysclock = 100
+
+#define BAD_PLLM (25)
+#define BAD_PLLN (400)
+#define BAD_PLLQ (10)
+#define BAD_PLLP (PLLP4)
+
+#define BAD_AHB_PRE     (HPRE_DIV_1)
+#define BAD_APB1_PRE    (PPRE_DIV_2)
+#define BAD_APB2_PRE    (PPRE_DIV_1)
+
+#define BAD_RCC_IMPLEMENTATION
+#define BAD_FLASH_IMPLEMENTATION
+#define BAD_GPIO_IMPLEMENTATION
+#define BAD_PWR_IMPLEMENTATION
+#define BAD_SYSTICK_SYSTICK_ISR_IMPLEMENTATION
+
+#define BAD_ILI9341_STATIC
+#define BAD_ILI9341_INCLUDE_ISRS
+#define BAD_ILI9341_IMPLEMENTATION
+#define BAD_ILI9341_IMAGE_IMPLEMENTATION
+#include "ili9341_image.h"
+#include "assets/badge.h" // python3 tools/image_convert.py tests/assets/badge.png --name badge -o tests/assets/badge.h
+
+//spi pins
+#define SPI_GPIO_PORT       (GPIOB)
+#define SPI_SCK_PIN         (3)
+#define SPI_MISO_PIN        (4)
+#define SPI_MOSI_PIN        (5)
+#define SPI_SCK_AF          (5)
+#define SPI_MISO_AF         (5)
+#define SPI_MOSI_AF         (5)
+
+#define BADHAL_FLASH_LATENCY (FLASH_LATENCY_3ws)
+
+#define BAD_IMAGE_TEST_AHB1_PERIPEHRALS  (RCC_AHB1_GPIOB)
+#define BAD_IMAGE_TEST_REFRESH_MS        (500)
+
+//two stripes of 16 rows, only taken while the badge is drawn
+POOL_DEFINE(stripe_blocks, ILI9341_LCD_WIDTH * 16 * sizeof(uint16_t), 2, 16);
+
+static const GPIO_port_config_t spi_port = IO_PORT_CONFIG(
+    IO_PIN(SPI_SCK_PIN, MODER_af, SPI_SCK_AF, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull),
+    IO_PIN(SPI_MISO_PIN, MODER_af, SPI_MISO_AF, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull),
+    IO_PIN(SPI_MOSI_PIN, MODER_af, SPI_MOSI_AF, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull),
+    IO_PIN(ILI9341_CS_PIN, MODER_output, 0, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull),
+    IO_PIN(ILI9341_RESET_PIN, MODER_output, 0, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull),
+    IO_PIN(ILI9341_DC_PIN, MODER_output, 0, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull)
+);
+
+volatile uint32_t ticks;
+volatile uint32_t draw_cycles;
+
+void systick_usr(){
+    ++ticks;
+}
+
+static inline void __main_clock_setup(){
+    flash_acceleration_setup(BADHAL_FLASH_LATENCY, FLASH_DCACHE_ENABLE, FLASH_ICACHE_ENABLE);
+    rcc_sysclock_setup();
+}
+
+static inline void __periph_setup(){
+    rcc_set_ahb1_clocking(BAD_IMAGE_TEST_AHB1_PERIPEHRALS);
+    io_setup_port(SPI_GPIO_PORT, &spi_port);
+    ili9341_spi_init();
+}
+
+static inline void __systick_setup(){
+    systick_setup(CLOCK_SPEED/1000, SYSTICK_FEATURE_CLOCK_SOURCE|SYSTICK_FEATURE_TICK_INTERRUPT);
+    systick_enable();
+}
+
+int main(){
+    __DISABLE_INTERUPTS;
+    __main_clock_setup();
+    __periph_setup();
+    __systick_setup();
+    dwt_cycle_counter_enable();
+
+    __ENABLE_INTERUPTS;
+    ili9341_init();
+    ili9341_fill(0x0000);
+
+    //the badge walks down the screen, 2KB of flash and two pool blocks of RAM
+    //instead of a 25KB bitmap, draw_cycles is the time to decode and send all stripes
+    uint16_t y = 0;
+    uint32_t next = 0;
+    while(1){
+        IDLE_WAIT_UNTIL(ticks >= next);
+        next += BAD_IMAGE_TEST_REFRESH_MS;
+
+        uint32_t start = dwt_cycles();
+        ili9341_draw_image(&badge, (ILI9341_LCD_WIDTH - badge.width) / 2, y, &stripe_blocks);
+        draw_cycles = dwt_cycles() - start;
+
+        y += badge.height;
+        if (y + badge.height > ILI9341_LCD_HEIGHT) {
+            y = 0;
+            ili9341_fill(0x0000);
+        }
+    }
+    return 0;
+}
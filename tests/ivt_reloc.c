@@ -47,14 +47,22 @@
 #define BAD_BTIMER_TEST_PSC    (1525)
 #define BAD_BTIMER_TEST_INTR   (BTIMER_UPDATE)
 
-extern uint32_t __ram_ivt;
+#define BAD_IVT_TEST_SWAP_AFTER (10) // seconds through the HAL isr before swapping
 
-uint32_t secondselapsed;
+volatile uint32_t secondselapsed;
+volatile uint32_t direct_entries;
 
 void ATTR_RAMFUNC tim10_usr(){
     secondselapsed++;
 }
 
+// installed straight into the RAM table, no HAL isr in between
+void ATTR_RAMFUNC tim10_direct(){
+    BTIM10->SR &= ~TIM_SR_UIF;
+    secondselapsed++;
+    direct_entries++;
+}
+
 
 static inline void __main_clock_setup(){
     flash_acceleration_setup(BADHAL_FLASH_LATENCY, FLASH_DCACHE_ENABLE, FLASH_ICACHE_ENABLE);
@@ -81,13 +89,16 @@ int main(){
     __DISABLE_INTERUPTS;
     __main_clock_setup();
     __periph_setup();
-    SCB->VTOR = (uint32_t)&__ram_ivt;
     __timer_setup(); 
-   
 
-    
     __ENABLE_INTERUPTS;
 
+    while(secondselapsed < BAD_IVT_TEST_SWAP_AFTER){
+
+    }
+    //hot swap, direct_entries starts counting from here
+    ivt_install(NVIC_TIM1_UP_TIM10_INTR, tim10_direct);
+
     while(1){
 
     }
@@ -0,0 +1,97 @@
+    // HSE  = 25
+    // PLLM = 25
+    // PLLN = 400
+    // PLLQ = 10
+    // PLLP = 4
+    // Sysclock = 100
+
+#define BAD_PLLM (25)
+#define BAD_PLLN (400)
+#define BAD_PLLQ (10)
+#define BAD_PLLP (PLLP4)
+
+#define BAD_AHB_PRE     (HPRE_DIV_1)
+#define BAD_APB1_PRE    (PPRE_DIV_2)
+#define BAD_APB2_PRE    (PPRE_DIV_1)
+
+#define BAD_RCC_IMPLEMENTATION
+#define BAD_GPIO_IMPLEMENTATION
+#define BAD_USART_IMPLEMENTATION
+#define BAD_FLASH_IMPLEMENTATION
+#define BAD_SYSTICK_SYSTICK_ISR_IMPLEMENTATION
+#define BAD_RETAINED_IMPLEMENTATION
+#include "retained.h"
+
+#define UART_GPIO_PORT          (GPIOA)
+#define UART1_TX_PIN            (9)
+#define UART1_RX_PIN            (10)
+#define UART1_TX_AF             (7)
+#define UART1_RX_AF             (7)
+
+#define BADHAL_FLASH_LATENCY (FLASH_LATENCY_3ws)
+
+#define BAD_RETAINED_TEST_AHB1_PERIPEHRALS  (RCC_AHB1_GPIOA|RCC_AHB1_CRCEN)
+#define BAD_RETAINED_TEST_APB2_PERIPHERALS  (RCC_APB2_USART1)
+#define BAD_RETAINED_TEST_UART_SETTINGS     (USART_FEATURE_TRANSMIT_EN)
+#define BAD_RETAINED_TEST_RESET_MS          (5000)
+
+static const GPIO_port_config_t uart_port = IO_PORT_CONFIG(
+    IO_PIN(UART1_TX_PIN, MODER_af, UART1_TX_AF, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull),
+    IO_PIN(UART1_RX_PIN, MODER_af, UART1_RX_AF, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull)
+);
+
+volatile uint32_t ticks;
+
+void systick_usr(){
+    ++ticks;
+}
+
+static inline void __main_clock_setup(){
+    flash_acceleration_setup(BADHAL_FLASH_LATENCY, FLASH_DCACHE_ENABLE, FLASH_ICACHE_ENABLE);
+    rcc_sysclock_setup();
+}
+
+static inline void __periph_setup(){
+    rcc_set_ahb1_clocking(BAD_RETAINED_TEST_AHB1_PERIPEHRALS);
+    io_setup_port(UART_GPIO_PORT, &uart_port);
+    rcc_set_apb2_clocking(BAD_RETAINED_TEST_APB2_PERIPHERALS);
+}
+
+static inline void __uart_setup(){
+    uart_setup(USART1, USART_BRR_115200, BAD_RETAINED_TEST_UART_SETTINGS, 0, 0);
+    uart_enable(USART1);
+}
+
+static inline void __systick_setup(){
+    systick_setup(CLOCK_SPEED/1000, SYSTICK_FEATURE_CLOCK_SOURCE|SYSTICK_FEATURE_TICK_INTERRUPT);
+    systick_enable();
+}
+
+int main(){
+    __DISABLE_INTERUPTS;
+    __main_clock_setup();
+    __periph_setup();
+    __uart_setup();
+    uint8_t warm = retained_init();
+    __systick_setup();
+
+    __ENABLE_INTERUPTS;
+    uart_send_str_polling(USART1, warm ? "RETAINED BLOCK KEPT\r\n" : "RETAINED BLOCK CLEARED\r\n");
+    uart_send_str_polling(USART1, "RESET CAUSE: ");
+    uart_send_str_polling(USART1, retained_reset_cause_name(retained_reset_cause()));
+    uart_send_str_polling(USART1, "\r\nBOOT COUNT: ");
+    uart_send_dec_unsigned_32bit(USART1, retained.block.boot_count);
+    uart_send_str_polling(USART1, "CRASH COUNT: ");
+    uart_send_dec_unsigned_32bit(USART1, retained.block.crash_count);
+    if (retained.block.crash_count) {
+        uart_send_str_polling(USART1, "LAST FAULT PC: ");
+        uart_send_hex_32bit(USART1, retained.block.last_fault_pc);
+        uart_send_str_polling(USART1, "LAST FAULT CFSR: ");
+        uart_send_hex_32bit(USART1, retained.block.last_fault_cfsr);
+    }
+
+    //software reset every few seconds, boot count has to keep going up
+    while(ticks < BAD_RETAINED_TEST_RESET_MS);
+    SCB_system_reset();
+    return 0;
+}
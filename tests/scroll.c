@@ -0,0 +1,169 @@
+    // HSE  = 25
+    // PLLM = 25
+    // PLLN = 400
+    // PLLQ = 10
+    // PLLP = 4
+    // Sysclock = 100
+
+#define BAD_PLLM (25)
+#define BAD_PLLN (400)
+#define BAD_PLLQ (10)
+#define BAD_PLLP (PLLP4)
+
+#define BAD_AHB_PRE     (HPRE_DIV_1)
+#define BAD_APB1_PRE    (PPRE_DIV_2)
+#define BAD_APB2_PRE    (PPRE_DIV_1)
+
+
+#define BAD_RCC_IMPLEMENTATION
+#define BAD_FLASH_IMPLEMENTATION
+#define BAD_GPIO_IMPLEMENTATION
+#define BAD_PWR_IMPLEMENTATION
+#define BAD_SYSTICK_SYSTICK_ISR_IMPLEMENTATION
+
+#define BAD_ILI9341_STATIC
+#define BAD_ILI9341_INCLUDE_ISRS
+#define BAD_ILI9341_IMPLEMENTATION
+#define BAD_ILI9341_TEXT_IMPLEMENTATION
+#include "ili9341_text.h"
+#include "fonts/font_mono_12.h"
+
+//spi pins
+#define SPI_GPIO_PORT       (GPIOB)
+#define SPI_SCK_PIN         (3)
+#define SPI_MISO_PIN        (4)
+#define SPI_MOSI_PIN        (5)
+#define SPI_SCK_AF          (5)
+#define SPI_MISO_AF         (5)
+#define SPI_MOSI_AF         (5)
+
+#define BADHAL_FLASH_LATENCY (FLASH_LATENCY_3ws)
+
+#define BAD_SCROLL_TEST_AHB1_PERIPEHRALS  (RCC_AHB1_GPIOB)
+#define BAD_SCROLL_TEST_LINE_MS         (200)
+#define BAD_SCROLL_TEST_COLUMN_MS       (10)
+#define BAD_SCROLL_TEST_LINES           (64)    //per log phase
+#define BAD_SCROLL_TEST_SAMPLES         (4 * ILI9341_LCD_HEIGHT) //per plot phase, 4 screens
+#define BAD_SCROLL_TEST_HEADER_ROWS     (16)    //fixed, 304 scrolling rows are 19 lines of 16
+
+//the two glyph expansion buffers, a 7x16 glyph per block
+POOL_DEFINE(glyph_blocks, 7 * 16 * sizeof(uint16_t), 2, 16);
+
+static const GPIO_port_config_t spi_port = IO_PORT_CONFIG(
+    IO_PIN(SPI_SCK_PIN, MODER_af, SPI_SCK_AF, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull),
+    IO_PIN(SPI_MISO_PIN, MODER_af, SPI_MISO_AF, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull),
+    IO_PIN(SPI_MOSI_PIN, MODER_af, SPI_MOSI_AF, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull),
+    IO_PIN(ILI9341_CS_PIN, MODER_output, 0, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull),
+    IO_PIN(ILI9341_RESET_PIN, MODER_output, 0, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull),
+    IO_PIN(ILI9341_DC_PIN, MODER_output, 0, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull)
+);
+
+volatile uint32_t ticks;
+
+//one plot column, the landscape screen is 240 rows high
+static uint16_t column[ILI9341_LCD_WIDTH] __attribute__((aligned(16)));
+
+void systick_usr(){
+    ++ticks;
+}
+
+static inline void __main_clock_setup(){
+    flash_acceleration_setup(BADHAL_FLASH_LATENCY, FLASH_DCACHE_ENABLE, FLASH_ICACHE_ENABLE);
+    rcc_sysclock_setup();
+}
+
+static inline void __periph_setup(){
+    rcc_set_ahb1_clocking(BAD_SCROLL_TEST_AHB1_PERIPEHRALS);
+    io_setup_port(SPI_GPIO_PORT, &spi_port);
+    ili9341_spi_init();
+}
+
+static inline void __systick_setup(){
+    systick_setup(CLOCK_SPEED/1000, SYSTICK_FEATURE_CLOCK_SOURCE|SYSTICK_FEATURE_TICK_INTERRUPT);
+    systick_enable();
+}
+
+static void __format_number(uint32_t value, char *out, uint8_t digits){
+    for (int8_t i = digits - 1; i >= 0; i--) {
+        out[i] = '0' + value % 10;
+        value /= 10;
+    }
+}
+
+//Portrait log under a fixed header, a new line is a VSCRSADD write plus one
+//line of glyph DMA, the cycles of the previous line are printed in the next
+static void __log_phase(const ILI9341_text_style_t *style){
+    ili9341_set_rotation(ILI9341_ROTATION_0);
+    ili9341_fill(0x0000);
+    ili9341_draw_text(style, 0, 0, "LINE   CYCLES   (HW SCROLL)", &glyph_blocks);
+    ili9341_scroll_setup(BAD_SCROLL_TEST_HEADER_ROWS, 0);
+
+    //34 cells cover the 240 pixel line, old text is overwritten by spaces
+    char text[] = "#0000  00000000                   ";
+    uint32_t cycles = 0;
+    uint32_t next = ticks;
+    for (uint32_t line = 0; line < BAD_SCROLL_TEST_LINES; line++) {
+        IDLE_WAIT_UNTIL(ticks >= next);
+        next += BAD_SCROLL_TEST_LINE_MS;
+
+        uint32_t start = dwt_cycles();
+        __format_number(line, &text[1], 4);
+        __format_number(cycles, &text[7], 8);
+        uint16_t y = ili9341_scroll_line(font_mono_12.height);
+        ili9341_draw_text(style, 0, y, text, &glyph_blocks);
+        cycles = dwt_cycles() - start;
+    }
+    ili9341_scroll_off();
+}
+
+//Landscape plot, the panel rows are the x axis here, so a new sample is one
+//240 pixel column and the older ones move left in hardware
+static void __plot_phase(){
+    ili9341_set_rotation(ILI9341_ROTATION_90);
+    ili9341_fill(0x0000);
+    ili9341_scroll_setup(0, 0);
+
+    uint32_t next = ticks;
+    uint16_t level = ILI9341_LCD_WIDTH / 2;
+    int16_t step = 3;
+    for (uint32_t sample = 0; sample < BAD_SCROLL_TEST_SAMPLES; sample++) {
+        IDLE_WAIT_UNTIL(ticks >= next);
+        next += BAD_SCROLL_TEST_COLUMN_MS;
+
+        //triangle wave, the column buffer is free once the last fill is done
+        level += step;
+        if (level <= 3 || level >= ILI9341_LCD_WIDTH - 4) {
+            step = -step;
+        }
+        ili9341_wait_dma_ready();
+        for (uint16_t y = 0; y < ILI9341_LCD_WIDTH; y++) {
+            column[y] = y == ILI9341_LCD_WIDTH / 2 ? 0x39E7 : 0x0000;
+        }
+        column[ILI9341_LCD_WIDTH - 1 - level] = 0x07E0;
+
+        uint16_t x = ili9341_scroll_line(1);
+        ili9341_fb_dma_fill(column, x, 0, x, ILI9341_LCD_WIDTH - 1);
+    }
+    ili9341_wait_dma_ready();
+    ili9341_scroll_off();
+}
+
+int main(){
+    __DISABLE_INTERUPTS;
+    __main_clock_setup();
+    __periph_setup();
+    __systick_setup();
+    dwt_cycle_counter_enable();
+
+    __ENABLE_INTERUPTS;
+    ili9341_init();
+
+    ILI9341_text_style_t style;
+    ili9341_text_style(&style, &font_mono_12, 0x07E0, 0x0000);
+
+    while(1){
+        __log_phase(&style);
+        __plot_phase();
+    }
+    return 0;
+}
@@ -0,0 +1,138 @@
+    // HSE  = 25
+    // PLLM = 25
+    // PLLN = 400
+    // PLLQ = 10
+    // PLLP = 4
+    // Sysclock = 100
+
+#define BAD_PLLM (25)
+#define BAD_PLLN (400)
+#define BAD_PLLQ (10)
+#define BAD_PLLP (PLLP4)
+
+#define BAD_AHB_PRE     (HPRE_DIV_1)
+#define BAD_APB1_PRE    (PPRE_DIV_2)
+#define BAD_APB2_PRE    (PPRE_DIV_1)
+
+
+#define BAD_RCC_IMPLEMENTATION
+#define BAD_FLASH_IMPLEMENTATION
+#define BAD_GPIO_IMPLEMENTATION
+#define BAD_PWR_IMPLEMENTATION
+#define BAD_SYSTICK_SYSTICK_ISR_IMPLEMENTATION
+#define BAD_EXTI_IMPLEMENTATION
+#define BAD_EXTI_DISPATCH_ISR_IMPLEMENTATION
+
+#define BAD_ILI9341_STATIC
+#define BAD_ILI9341_INCLUDE_ISRS
+#define BAD_ILI9341_USE_TE
+#define BAD_ILI9341_IMPLEMENTATION
+#include "ili9341.h"
+
+//spi pins
+#define SPI_GPIO_PORT       (GPIOB)
+#define SPI_SCK_PIN         (3)
+#define SPI_MISO_PIN        (4)
+#define SPI_MOSI_PIN        (5)
+#define SPI_SCK_AF          (5)
+#define SPI_MISO_AF         (5)
+#define SPI_MOSI_AF         (5)
+
+#define BADHAL_FLASH_LATENCY (FLASH_LATENCY_3ws)
+
+#define BAD_TEARING_TEST_AHB1_PERIPEHRALS (RCC_AHB1_GPIOB)
+#define BAD_TEARING_TEST_WIDTH          (240)
+#define BAD_TEARING_TEST_HEIGHT         (120)
+#define BAD_TEARING_TEST_BAR            (16)
+#define BAD_TEARING_TEST_SPEED          (6)     //pixels per frame, fast enough to show a tear
+#define BAD_TEARING_TEST_INTERVAL       (2)     //TE edges per frame
+#define BAD_TEARING_TEST_REPORT_MS      (1000)
+
+ILI9341_FB_STATIC_CHECK(BAD_TEARING_TEST_WIDTH, BAD_TEARING_TEST_HEIGHT);
+
+static const GPIO_port_config_t spi_port = IO_PORT_CONFIG(
+    IO_PIN(SPI_SCK_PIN, MODER_af, SPI_SCK_AF, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull),
+    IO_PIN(SPI_MISO_PIN, MODER_af, SPI_MISO_AF, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull),
+    IO_PIN(SPI_MOSI_PIN, MODER_af, SPI_MOSI_AF, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull),
+    IO_PIN(ILI9341_CS_PIN, MODER_output, 0, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull),
+    IO_PIN(ILI9341_RESET_PIN, MODER_output, 0, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull),
+    IO_PIN(ILI9341_DC_PIN, MODER_output, 0, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull),
+    IO_PIN(ILI9341_TE_PIN, MODER_reset_input, 0, OSPEEDR_high_speed, PUPDR_pulldown, OTYPR_push_pull)
+);
+
+//two band buffers, one drawn while the other is on the wire
+static uint16_t band[2][BAD_TEARING_TEST_WIDTH * BAD_TEARING_TEST_HEIGHT] __attribute__((aligned(16)));
+
+volatile uint32_t ticks;
+
+//watch in the debugger, updated every BAD_TEARING_TEST_REPORT_MS
+volatile uint32_t refresh_x100;
+volatile uint32_t fps_x100;
+volatile uint32_t missed_vblanks;
+volatile uint32_t idle_vblanks;
+
+void systick_usr(){
+    ++ticks;
+}
+
+static inline void __main_clock_setup(){
+    flash_acceleration_setup(BADHAL_FLASH_LATENCY, FLASH_DCACHE_ENABLE, FLASH_ICACHE_ENABLE);
+    rcc_sysclock_setup();
+}
+
+static inline void __periph_setup(){
+    rcc_set_ahb1_clocking(BAD_TEARING_TEST_AHB1_PERIPEHRALS);
+    io_setup_port(SPI_GPIO_PORT, &spi_port);
+    ili9341_spi_init();
+}
+
+static inline void __systick_setup(){
+    systick_setup(CLOCK_SPEED/1000, SYSTICK_FEATURE_CLOCK_SOURCE|SYSTICK_FEATURE_TICK_INTERRUPT);
+    systick_enable();
+}
+
+//a vertical bar moving sideways, a tear shows up as a bar broken in two
+static void __draw_band(uint16_t *fb, uint16_t bar_x){
+    for (uint16_t y = 0; y < BAD_TEARING_TEST_HEIGHT; y++) {
+        for (uint16_t x = 0; x < BAD_TEARING_TEST_WIDTH; x++) {
+            *fb++ = (uint16_t)(x - bar_x) < BAD_TEARING_TEST_BAR ? 0xFFFF : 0x001F;
+        }
+    }
+}
+
+int main(){
+    __DISABLE_INTERUPTS;
+    __main_clock_setup();
+    __periph_setup();
+    __systick_setup();
+    dwt_cycle_counter_enable();
+
+    __ENABLE_INTERUPTS;
+    ili9341_init();
+    ili9341_fill(0x0000);
+    //the band is ~9 ms of SPI at 50 MHz, two periods of 70 Hz leave plenty of slack
+    ili9341_set_frame_rate(ILI9341_FRAME_RATE_70HZ);
+    ili9341_te_setup(BAD_TEARING_TEST_INTERVAL);
+
+    uint16_t y = (ILI9341_LCD_HEIGHT - BAD_TEARING_TEST_HEIGHT) / 2;
+    uint16_t bar_x = 0;
+    uint8_t next = 0;
+    uint32_t report = ticks + BAD_TEARING_TEST_REPORT_MS;
+    while(1){
+        __draw_band(band[next], bar_x);
+        bar_x = (bar_x + BAD_TEARING_TEST_SPEED) % (BAD_TEARING_TEST_WIDTH - BAD_TEARING_TEST_BAR);
+        ili9341_te_present(band[next], 0, y, BAD_TEARING_TEST_WIDTH - 1, y + BAD_TEARING_TEST_HEIGHT - 1);
+        next ^= 1;
+        ili9341_te_wait_started();
+
+        if (ticks >= report) {
+            report += BAD_TEARING_TEST_REPORT_MS;
+            refresh_x100 = ili9341_te_refresh_x100();
+            fps_x100 = ili9341_te_fps_x100();
+            missed_vblanks = ili9341_te_stats.missed;
+            idle_vblanks = ili9341_te_stats.idle;
+            ili9341_te_stats_reset();
+        }
+    }
+    return 0;
+}
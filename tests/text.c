@@ -0,0 +1,126 @@
+    // HSE  = 25
+    // PLLM = 25
+    // PLLN = 400
+    // PLLQ = 10
+    // PLLP = 4
+    // Sysclock = 100
+
+#define BAD_PLLM (25)
+#define BAD_PLLN (400)
+#define BAD_PLLQ (10)
+#define BAD_PLLP (PLLP4)
+
+#define BAD_AHB_PRE     (HPRE_DIV_1)
+#define BAD_APB1_PRE    (PPRE_DIV_2)
+#define BAD_APB2_PRE    (PPRE_DIV_1)
+
+#define BAD_RCC_IMPLEMENTATION
+#define BAD_FLASH_IMPLEMENTATION
+#define BAD_GPIO_IMPLEMENTATION
+#define BAD_PWR_IMPLEMENTATION
+#define BAD_SYSTICK_SYSTICK_ISR_IMPLEMENTATION
+
+#define BAD_ILI9341_STATIC
+#define BAD_ILI9341_INCLUDE_ISRS
+#define BAD_ILI9341_IMPLEMENTATION
+#define BAD_ILI9341_TEXT_IMPLEMENTATION
+#include "ili9341_text.h"
+#include "fonts/font_mono_16.h"
+#include "fonts/font_mono_12.h"
+
+//spi pins
+#define SPI_GPIO_PORT       (GPIOB)
+#define SPI_SCK_PIN         (3)
+#define SPI_MISO_PIN        (4)
+#define SPI_MOSI_PIN        (5)
+#define SPI_SCK_AF          (5)
+#define SPI_MISO_AF         (5)
+#define SPI_MOSI_AF         (5)
+
+#define BADHAL_FLASH_LATENCY (FLASH_LATENCY_3ws)
+
+#define BAD_TEXT_TEST_AHB1_PERIPEHRALS  (RCC_AHB1_GPIOB)
+#define BAD_TEXT_TEST_REFRESH_MS        (100)
+
+//11 cached readout glyphs + 2 expansion buffers, a 10x20 glyph per block
+POOL_DEFINE(glyph_blocks, 10 * 20 * sizeof(uint16_t), 13, 16);
+
+static const GPIO_port_config_t spi_port = IO_PORT_CONFIG(
+    IO_PIN(SPI_SCK_PIN, MODER_af, SPI_SCK_AF, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull),
+    IO_PIN(SPI_MISO_PIN, MODER_af, SPI_MISO_AF, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull),
+    IO_PIN(SPI_MOSI_PIN, MODER_af, SPI_MOSI_AF, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull),
+    IO_PIN(ILI9341_CS_PIN, MODER_output, 0, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull),
+    IO_PIN(ILI9341_RESET_PIN, MODER_output, 0, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull),
+    IO_PIN(ILI9341_DC_PIN, MODER_output, 0, OSPEEDR_high_speed, PUPDR_no_pull, OTYPR_push_pull)
+);
+
+volatile uint32_t ticks;
+
+void systick_usr(){
+    ++ticks;
+}
+
+static inline void __main_clock_setup(){
+    flash_acceleration_setup(BADHAL_FLASH_LATENCY, FLASH_DCACHE_ENABLE, FLASH_ICACHE_ENABLE);
+    rcc_sysclock_setup();
+}
+
+static inline void __periph_setup(){
+    rcc_set_ahb1_clocking(BAD_TEXT_TEST_AHB1_PERIPEHRALS);
+    io_setup_port(SPI_GPIO_PORT, &spi_port);
+    ili9341_spi_init();
+}
+
+static inline void __systick_setup(){
+    systick_setup(CLOCK_SPEED/1000, SYSTICK_FEATURE_CLOCK_SOURCE|SYSTICK_FEATURE_TICK_INTERRUPT);
+    systick_enable();
+}
+
+//fixed 8 chars so a shorter number overwrites the old digits, dot < 0 for none
+static void __format_fixed(uint32_t value, char *out, int8_t dot){
+    for (int8_t i = 7; i >= 0; i--) {
+        if (i == dot) {
+            out[i] = '.';
+            continue;
+        }
+        out[i] = '0' + value % 10;
+        value /= 10;
+    }
+    out[8] = 0;
+}
+
+int main(){
+    __DISABLE_INTERUPTS;
+    __main_clock_setup();
+    __periph_setup();
+    __systick_setup();
+    dwt_cycle_counter_enable();
+
+    __ENABLE_INTERUPTS;
+    ili9341_init();
+    ili9341_fill(0x0000);
+
+    ILI9341_text_style_t label, readout;
+    ili9341_text_style(&label, &font_mono_12, 0x07E0, 0x0000);
+    ili9341_text_style(&readout, &font_mono_16, 0xFFFF, 0x0000);
+    ili9341_text_cache(&readout, "0123456789.", &glyph_blocks);
+
+    ili9341_draw_text(&label, 10, 10, "UPTIME S (4BPP CACHED)", &glyph_blocks);
+    ili9341_draw_text(&label, 10, 70, "DRAW CYCLES (1BPP)", &glyph_blocks);
+
+    char text[12];
+    uint32_t next = 0;
+    while(1){
+        IDLE_WAIT_UNTIL(ticks >= next);
+        next += BAD_TEXT_TEST_REFRESH_MS;
+
+        uint32_t start = dwt_cycles();
+        __format_fixed(ticks, text, 4);
+        ili9341_draw_text(&readout, 10, 30, text, &glyph_blocks); //8 glyph bursts straight from the cache
+        uint32_t cycles = dwt_cycles() - start;
+
+        __format_fixed(cycles, text, -1);
+        ili9341_draw_text(&label, 10, 90, text, &glyph_blocks);
+    }
+    return 0;
+}
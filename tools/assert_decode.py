@@ -0,0 +1,73 @@
+#!/usr/bin/env python3
+"""Decode ASSERT_LEVEL_TOKEN tokens back to file:line.
+
+usage: assert_decode.py TOKEN [TOKEN ...] [--root DIR]
+
+Tokens are the hex words printed as "ASSERT 4C1A0077". The hash has to match
+ASSERT_HASH in inc/assert.h: h = h * 31 + c over the first 32 chars of the
+file name, zero padded, folded to 16 bits. Compilers with __FILE_NAME__ hash
+the basename, older ones fall back to __FILE__, the path as given on the
+command line, so both the basename and the path relative to --root are indexed.
+"""
+import argparse
+import os
+import sys
+
+HASH_LEN = 32
+SOURCE_EXT = (".c", ".h")
+
+
+def file_hash(name):
+    h = 0
+    for c in name.encode()[:HASH_LEN].ljust(HASH_LEN, b"\0"):
+        h = (h * 31 + c) & 0xFFFFFFFF
+    return (h ^ (h >> 16)) & 0xFFFF
+
+
+def index_sources(root):
+    table = {}
+    for dirpath, dirnames, filenames in os.walk(root):
+        dirnames[:] = [d for d in dirnames if not d.startswith(".") and d != "build"]
+        for name in filenames:
+            if name.endswith(SOURCE_EXT):
+                path = os.path.join(dirpath, name)
+                relative = os.path.relpath(path, root).replace(os.sep, "/")
+                for key in {file_hash(name), file_hash(relative)}:
+                    table.setdefault(key, []).append(path)
+    return table
+
+
+def source_line(path, line):
+    try:
+        with open(path, errors="replace") as f:
+            for i, text in enumerate(f, 1):
+                if i == line:
+                    return text.strip()
+    except OSError:
+        pass
+    return ""
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("tokens", nargs="+")
+    parser.add_argument("--root", default=os.path.join(os.path.dirname(__file__), ".."))
+    args = parser.parse_args()
+
+    table = index_sources(args.root)
+    status = 0
+    for token in args.tokens:
+        value = int(token, 16)
+        line = value & 0xFFFF
+        candidates = table.get(value >> 16)
+        if not candidates:
+            print("%08X: no file with hash %04X" % (value, value >> 16))
+            status = 1
+            continue
+        for path in candidates:
+            print("%08X: %s:%d  %s" % (value, os.path.relpath(path, args.root), line, source_line(path, line)))
+    return status
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+"""Rasterizes a TTF into a fixed cell ILI9341_font_t header for ili9341_text.h.
+
+    python3 tools/font_convert.py DejaVuSansMono.ttf 16 --bpp 4 --name font_mono_16 \
+        -o inc/fonts/font_mono_16.h
+
+Glyphs are stored row major, MSB first, every row padded to a byte. --bpp 1
+thresholds the coverage, --bpp 4 keeps 16 anti aliasing levels. The cell is
+the widest advance by ascent + descent, the height is padded until
+width * height is a multiple of 8 pixels so a glyph is a whole number of
+incr4 DMA bursts. Needs Pillow (pip install pillow).
+"""
+import argparse
+import os
+import sys
+
+from PIL import Image, ImageDraw, ImageFont
+
+
+def rasterize(font, ch, width, height, ascent):
+    img = Image.new("L", (width, height), 0)
+    draw = ImageDraw.Draw(img)
+    left = (width - round(font.getlength(ch))) // 2
+    draw.text((left, ascent), ch, font=font, fill=255, anchor="ls")
+    return img
+
+
+def pack(img, bpp):
+    width, height = img.size
+    px = img.load()
+    out = []
+    for y in range(height):
+        row = 0
+        bits = 0
+        for x in range(width):
+            value = px[x, y]
+            if bpp == 1:
+                level = 1 if value >= 128 else 0
+            else:
+                level = (value * 15 + 127) // 255
+            row = (row << bpp) | level
+            bits += bpp
+            if bits == 8:
+                out.append(row)
+                row = 0
+                bits = 0
+        if bits:
+            out.append(row << (8 - bits))
+    return out
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("ttf")
+    parser.add_argument("size", type=int, help="pixel size passed to the rasterizer")
+    parser.add_argument("--bpp", type=int, choices=(1, 4), default=1)
+    parser.add_argument("--first", type=lambda v: int(v, 0), default=0x20)
+    parser.add_argument("--last", type=lambda v: int(v, 0), default=0x7E)
+    parser.add_argument("--name", required=True, help="C identifier of the font")
+    parser.add_argument("-o", "--output", help="header to write, stdout without it")
+    args = parser.parse_args()
+
+    font = ImageFont.truetype(args.ttf, args.size)
+    ascent, descent = font.getmetrics()
+    chars = [chr(c) for c in range(args.first, args.last + 1)]
+    width = max(round(font.getlength(ch)) for ch in chars)
+    height = ascent + descent
+    while (width * height) % 8:
+        height += 1
+
+    glyphs = [pack(rasterize(font, ch, width, height, ascent), args.bpp) for ch in chars]
+    row_bytes = (width * args.bpp + 7) // 8
+    glyph_bytes = row_bytes * height
+    guard = "BAD_FONT_" + args.name.upper() + "_H"
+
+    lines = [
+        "// Generated by tools/font_convert.py from %s, size %d, %d bpp, don't edit"
+        % (os.path.basename(args.ttf), args.size, args.bpp),
+        "// %dx%d cell, chars 0x%02X-0x%02X, %d bytes" % (width, height, args.first, args.last, glyph_bytes * len(chars)),
+        "#pragma once",
+        "#ifndef " + guard,
+        "#define " + guard,
+        "",
+        '#include "ili9341_text.h"',
+        "",
+        "static const uint8_t %s_glyphs[%d] = {" % (args.name, glyph_bytes * len(chars)),
+    ]
+    for ch, data in zip(chars, glyphs):
+        label = ch if ch not in "\\" else "backslash"
+        lines.append("    // '%s'" % label)
+        for y in range(height):
+            row = data[y * row_bytes:(y + 1) * row_bytes]
+            lines.append("    " + ",".join("0x%02X" % b for b in row) + ",")
+    lines += [
+        "};",
+        "",
+        "static const ILI9341_font_t %s = {" % args.name,
+        "    .glyphs = %s_glyphs," % args.name,
+        "    .first = 0x%02X," % args.first,
+        "    .last = 0x%02X," % args.last,
+        "    .width = %d," % width,
+        "    .height = %d," % height,
+        "    .bpp = %d," % args.bpp,
+        "    .row_bytes = %d," % row_bytes,
+        "    .glyph_bytes = %d" % glyph_bytes,
+        "};",
+        "",
+        "#endif",
+        "",
+    ]
+    text = "\n".join(lines)
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+"""Converts a PNG into a palette + RLE ILI9341_image_t header for ili9341_image.h.
+
+    python3 tools/image_convert.py logo.png --name logo -o inc/images/logo.h
+    python3 tools/image_convert.py photo.png --name photo --colors 64 -o photo.h
+
+Colors are reduced to RGB565 first, more than --colors (default 256) distinct
+ones are quantized with Pillow. Transparent pixels become --background.
+The height is padded with --background rows until width * height is a
+multiple of 8, the DMA moves whole 8 pixel bursts. Needs Pillow
+(pip install pillow).
+
+Stream format, pixels in row order, runs may cross rows:
+    1LLLLLLL idx          run of L+1 pixels of palette[idx]
+    0LLLLLLL idx * (L+1)  L+1 literal pixels
+"""
+import argparse
+import os
+import sys
+
+from PIL import Image
+
+
+def rgb565(r, g, b):
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+
+
+def encode(indices):
+    out = bytearray()
+    literal = []
+
+    def flush():
+        while literal:
+            chunk = literal[:128]
+            del literal[:128]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+
+    i = 0
+    while i < len(indices):
+        run = 1
+        while i + run < len(indices) and indices[i + run] == indices[i] and run < 128:
+            run += 1
+        # a run of 2 costs as much as two literals, only break the literal for 3+
+        if run >= 3:
+            flush()
+            out.append(0x80 | (run - 1))
+            out.append(indices[i])
+            i += run
+        else:
+            literal.append(indices[i])
+            i += 1
+    flush()
+    return out
+
+
+def rgb_pixels(img):
+    raw = img.tobytes()
+    return [rgb565(raw[i], raw[i + 1], raw[i + 2]) for i in range(0, len(raw), 3)]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("png")
+    parser.add_argument("--name", required=True, help="C identifier of the image")
+    parser.add_argument("--colors", type=int, default=256, help="palette size limit, at most 256")
+    parser.add_argument("--background", type=lambda v: int(v, 0), default=0x000000,
+                        help="0xRRGGBB used under transparent pixels")
+    parser.add_argument("-o", "--output", help="header to write, stdout without it")
+    args = parser.parse_args()
+
+    img = Image.open(args.png).convert("RGBA")
+    bg = Image.new("RGBA", img.size, ((args.background >> 16) & 0xFF, (args.background >> 8) & 0xFF,
+                                      args.background & 0xFF, 255))
+    img = Image.alpha_composite(bg, img).convert("RGB")
+    width, height = img.size
+    while (width * height) % 8:
+        height += 1
+    if height != img.size[1]:
+        padded = Image.new("RGB", (width, height), bg.getpixel((0, 0))[:3])
+        padded.paste(img, (0, 0))
+        img = padded
+
+    colors = set(rgb_pixels(img))
+    if len(colors) > min(args.colors, 256):
+        img = img.quantize(min(args.colors, 256), dither=Image.Dither.NONE).convert("RGB")
+
+    pixels = rgb_pixels(img)
+    palette = sorted(set(pixels))
+    lookup = {c: i for i, c in enumerate(palette)}
+    data = encode([lookup[p] for p in pixels])
+
+    raw = width * height * 2
+    packed = len(data) + len(palette) * 2
+    guard = "BAD_IMAGE_" + args.name.upper() + "_H"
+    lines = [
+        "// Generated by tools/image_convert.py from %s, don't edit" % os.path.basename(args.png),
+        "// %dx%d, %d colors, %d bytes (RGB565 %d bytes, %.1fx)"
+        % (width, height, len(palette), packed, raw, raw / packed),
+        "#pragma once",
+        "#ifndef " + guard,
+        "#define " + guard,
+        "",
+        '#include "ili9341_image.h"',
+        "",
+        "static const uint16_t %s_palette[%d] = {" % (args.name, len(palette)),
+    ]
+    for i in range(0, len(palette), 12):
+        lines.append("    " + ",".join("0x%04X" % c for c in palette[i:i + 12]) + ",")
+    lines += ["};", "", "static const uint8_t %s_data[%d] = {" % (args.name, len(data))]
+    for i in range(0, len(data), 16):
+        lines.append("    " + ",".join("0x%02X" % b for b in data[i:i + 16]) + ",")
+    lines += [
+        "};",
+        "",
+        "static const ILI9341_image_t %s = {" % args.name,
+        "    .palette = %s_palette," % args.name,
+        "    .data = %s_data," % args.name,
+        "    .width = %d," % width,
+        "    .height = %d" % height,
+        "};",
+        "",
+        "#endif",
+        "",
+    ]
+    text = "\n".join(lines)
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+    print("%s: %dx%d, %d colors, %d -> %d bytes (%.1fx)"
+          % (args.png, width, height, len(palette), raw, packed, raw / packed), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()